@@ -30,6 +30,14 @@ else()
 		NAMES sundials_kinsol
 	)
 
+	find_library(SUNDIALS_SUNLINSOLKLU_LIBRARY
+		NAMES sundials_sunlinsolklu
+	)
+
+	find_library(SUNDIALS_SUNMATRIXSPARSE_LIBRARY
+		NAMES sundials_sunmatrixsparse
+	)
+
 	set(SUNDIALS_LIBRARIES
 		${SUNDIALS_ARKODE_LIBRARY}
 		${SUNDIALS_CVODE_LIBRARY}
@@ -39,6 +47,15 @@ else()
 		${SUNDIALS_KINSOL_LIBRARY}
 	)
 
+	# Optional sparse matrix and KLU linear solver modules
+	if(SUNDIALS_SUNLINSOLKLU_LIBRARY AND SUNDIALS_SUNMATRIXSPARSE_LIBRARY)
+		list(APPEND SUNDIALS_LIBRARIES
+			${SUNDIALS_SUNLINSOLKLU_LIBRARY}
+			${SUNDIALS_SUNMATRIXSPARSE_LIBRARY}
+		)
+		set(Sundials_KLU_FOUND TRUE)
+	endif()
+
 	include(FindPackageHandleStandardArgs)
 	find_package_handle_standard_args(Sundials DEFAULT_MSG SUNDIALS_ARKODE_LIBRARY SUNDIALS_INCLUDE_DIR)
 
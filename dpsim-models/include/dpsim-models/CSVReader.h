@@ -37,6 +37,8 @@ private:
   std::map<String, String> mAssignPattern;
   /// Skip first row if it has no digits at beginning
   Bool mSkipFirstRow = true;
+  /// Number of threads used to read several profiles, zero for one per core
+  UInt mNumThreads = 0;
 
 public:
   /// set load profile assigning pattern. AUTO for assigning load profile name (csv file name) to load object with the same name (mName)
@@ -67,6 +69,8 @@ public:
   Real time_format_convert(const String &time);
   /// Skip first row if it has no digits at beginning
   void doSkipFirstRow(Bool value = true) { mSkipFirstRow = value; }
+  /// Number of threads used by assignLoadProfile, zero for one per core
+  void setNumThreads(UInt numThreads) { mNumThreads = numThreads; }
   ///
   MatrixRow csv2Eigen(const String &path);
 
@@ -84,6 +88,10 @@ public:
 
   /// TODO : deprecate in the future
   /// read in load profile with time stamp format specified
+  ///
+  /// The samples between start_time and end_time are stored on a uniform
+  /// time grid. Uniformly spaced files keep their own spacing, others are
+  /// resampled with time_step.
   PowerProfile readLoadProfile(
       fs::path file, Real start_time = -1, Real time_step = 1,
       Real end_time = -1,
@@ -108,6 +116,13 @@ public:
 
   /// interpolation for weighting factor data points
   Real interpol_linear(std::map<Real, Real> &data_wf, Real x);
+
+private:
+  /// Read the profile files of several loads in parallel
+  void readLoadProfiles(
+      std::vector<std::pair<std::shared_ptr<SP::Ph1::Load>, fs::path>> &jobs,
+      Real start_time, Real time_step, Real end_time,
+      CSVReader::DataFormat format);
 };
 
 // #### csv reader section
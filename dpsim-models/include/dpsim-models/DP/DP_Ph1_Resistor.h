@@ -89,6 +89,10 @@ public:
                    double resid[], std::vector<int> &off);
   ///Voltage Getter
   Complex daeInitialize();
+  /// Analytic Jacobian of daeResidual
+  bool daeJacobian(double ttime, const double state[], const double dstate_dt[],
+                   double cj, JacobianEntries &entries,
+                   std::vector<int> &off) override;
 };
 } // namespace Ph1
 } // namespace DP
@@ -156,6 +156,10 @@ public:
                    double resid[], std::vector<int> &off) override;
   ///Voltage Getter
   Complex daeInitialize() override;
+  /// Analytic Jacobian of daeResidual
+  bool daeJacobian(double ttime, const double state[], const double dstate_dt[],
+                   double cj, JacobianEntries &entries,
+                   std::vector<int> &off) override;
 };
 } // namespace Ph1
 } // namespace DP
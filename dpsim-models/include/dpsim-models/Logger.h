@@ -19,9 +19,44 @@
 
 #include <spdlog/fmt/ostr.h>
 
+#include <dpsim-models/Config.h>
 #include <dpsim-models/Definitions.h>
 #include <dpsim-models/MathUtils.h>
 
+// Logging macros for methods which are called in every simulation step, i.e.
+// MNA pre- and post-step tasks and everything they call (right side vector
+// stamps, voltage and current updates, signal and ODE steps). Initialization
+// code and logs of discrete events inside a step (switching, tap changes,
+// protection trips) keep using SPDLOG_LOGGER_*.
+//
+// Like SPDLOG_LOGGER_*, levels below SPDLOG_ACTIVE_LEVEL are compiled out.
+// In addition, the arguments are only evaluated if the logger has the level
+// enabled, so formatting costs nothing for components with logging turned
+// off. Without WITH_STEP_LOGGING, all of these statements are compiled out.
+#ifdef WITH_STEP_LOGGING
+#define CPS_STEP_LOG_GUARDED(logger, level, macro, ...)                        \
+  do {                                                                         \
+    if ((logger)->should_log(level))                                           \
+      macro(logger, __VA_ARGS__);                                              \
+  } while (0)
+#else
+#define CPS_STEP_LOG_GUARDED(logger, level, macro, ...)                        \
+  do {                                                                         \
+    if (false)                                                                 \
+      macro(logger, __VA_ARGS__);                                              \
+  } while (0)
+#endif
+
+#define CPS_STEP_LOG_TRACE(logger, ...)                                        \
+  CPS_STEP_LOG_GUARDED(logger, spdlog::level::trace, SPDLOG_LOGGER_TRACE,      \
+                       __VA_ARGS__)
+#define CPS_STEP_LOG_DEBUG(logger, ...)                                        \
+  CPS_STEP_LOG_GUARDED(logger, spdlog::level::debug, SPDLOG_LOGGER_DEBUG,      \
+                       __VA_ARGS__)
+#define CPS_STEP_LOG_INFO(logger, ...)                                         \
+  CPS_STEP_LOG_GUARDED(logger, spdlog::level::info, SPDLOG_LOGGER_INFO,        \
+                       __VA_ARGS__)
+
 namespace CPS {
 
 class Logger {
@@ -7,6 +7,10 @@
  *********************************************************************************/
 
 #pragma once
+
+#include <map>
+#include <vector>
+
 #include <dpsim-models/Definitions.h>
 
 namespace CPS {
@@ -18,5 +22,50 @@ struct PQData {
 struct PowerProfile {
   std::map<Real, PQData> pqData;
   std::map<Real, Real> weightingFactors;
+
+  /// Samples on a uniform time grid, filled by CSVReader. Either pqGrid or
+  /// weightingFactorGrid is used, the maps above stay empty in that case.
+  Real gridStart = 0;
+  /// Spacing of the grid, zero if the profile has no grid
+  Real gridStep = 0;
+  std::vector<PQData> pqGrid;
+  std::vector<Real> weightingFactorGrid;
+
+  Bool hasGrid() const { return gridStep > 0; }
+
+  /// Linear interpolation on the grid, clamped to its first and last sample
+  PQData pqAt(Real time) const {
+    size_t idx;
+    Real frac = gridPosition(time, pqGrid.size(), idx);
+    if (frac == 0)
+      return pqGrid[idx];
+    return {(1 - frac) * pqGrid[idx].p + frac * pqGrid[idx + 1].p,
+            (1 - frac) * pqGrid[idx].q + frac * pqGrid[idx + 1].q};
+  }
+
+  Real weightingFactorAt(Real time) const {
+    size_t idx;
+    Real frac = gridPosition(time, weightingFactorGrid.size(), idx);
+    if (frac == 0)
+      return weightingFactorGrid[idx];
+    return (1 - frac) * weightingFactorGrid[idx] +
+           frac * weightingFactorGrid[idx + 1];
+  }
+
+private:
+  /// Index of the grid sample before time and the fraction towards the next
+  Real gridPosition(Real time, size_t size, size_t &idx) const {
+    Real pos = (time - gridStart) / gridStep;
+    if (!(pos > 0) || size < 2) {
+      idx = 0;
+      return 0;
+    }
+    if (pos >= static_cast<Real>(size - 1)) {
+      idx = size - 1;
+      return 0;
+    }
+    idx = static_cast<size_t>(pos);
+    return pos - static_cast<Real>(idx);
+  }
 };
 } // namespace CPS
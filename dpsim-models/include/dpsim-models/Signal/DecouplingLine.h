@@ -31,6 +31,15 @@ protected:
   std::shared_ptr<DP::Ph1::CurrentSource> mSrc1, mSrc2;
   Attribute<Complex>::Ptr mSrcCur1, mSrcCur2;
 
+  /// Constant coefficients of the source current update, computed in
+  /// initialize()
+  Real mSrcAdmittance;
+  Real mRemoteGain;
+  Real mLocalGain;
+  Real mHistoryImpedance;
+  /// Phase shift of the delayed currents at the nominal frequency
+  Complex mDelayShift;
+
   // Ringbuffers for the values of previous timesteps
   // TODO make these matrix attributes
   std::vector<Complex> mVolt1, mVolt2, mCur1, mCur2;
@@ -31,6 +31,13 @@ protected:
   std::shared_ptr<EMT::Ph1::CurrentSource> mSrc1, mSrc2;
   Attribute<Complex>::Ptr mSrcCur1, mSrcCur2;
 
+  /// Constant coefficients of the source current update, computed in
+  /// initialize()
+  Real mSrcAdmittance;
+  Real mRemoteGain;
+  Real mLocalGain;
+  Real mHistoryImpedance;
+
   // Ringbuffers for the values of previous timesteps
   // TODO make these matrix attributes
   std::vector<Real> mVolt1, mVolt2, mCur1, mCur2;
@@ -32,14 +32,23 @@ protected:
   std::shared_ptr<EMT::Ph3::ControlledCurrentSource> mSrc1, mSrc2;
   Attribute<Matrix>::Ptr mSrcCur1, mSrcCur2;
 
-  // Ringbuffers for the values of previous timesteps
+  /// Constant coefficients of the source current update, computed in
+  /// initialize() so that a step needs no inversions or allocations
+  MatrixFixedSize<3, 3> mSrcAdmittance;
+  MatrixFixedSize<3, 3> mRemoteGain;
+  MatrixFixedSize<3, 3> mLocalGain;
+  MatrixFixedSize<3, 3> mHistoryImpedance;
+
+  // Ringbuffers for the values of previous timesteps, one column per step
   // TODO make these matrix attributes
-  Matrix mVolt1, mVolt2, mCur1, mCur2;
+  MatrixFixedSize<3, Eigen::Dynamic> mVolt1, mVolt2, mCur1, mCur2;
   UInt mBufIdx = 0;
   UInt mBufSize;
   Real mAlpha;
 
-  Matrix interpolate(Matrix &data);
+  /// Interpolate the delayed value of a ringbuffer into result
+  void interpolate(const MatrixFixedSize<3, Eigen::Dynamic> &data,
+                   MatrixFixedSize<3, 1> &result) const;
 
 public:
   typedef std::shared_ptr<DecouplingLineEMT_Ph3> Ptr;
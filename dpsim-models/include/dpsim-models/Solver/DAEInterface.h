@@ -19,6 +19,11 @@ public:
 
   using ResFn = std::function<void(double, const double *, const double *,
                                    double *, std::vector<int> &)>;
+  /// Nonzero entries of a sparse Jacobian as (row, column, value)
+  using JacobianEntries = std::vector<Eigen::Triplet<Real>>;
+  using JacFn =
+      std::function<bool(double, const double *, const double *, double,
+                         JacobianEntries &, std::vector<int> &)>;
 
   // #### DAE Section ####
   ///Residual Function for DAE Solver
@@ -27,5 +32,15 @@ public:
                            std::vector<int> &off) = 0;
   ///Voltage Getter for Components
   virtual Complex daeInitialize() = 0;
+  /// Jacobian of the residual, dF/dy + cj * dF/dy', for the same equations
+  /// and offsets as daeResidual. It has to add the same entries on every
+  /// call, even if their value is zero, so that the sparsity pattern stays
+  /// constant. Returns false if the component has no analytic Jacobian; the
+  /// solver then falls back to a dense difference quotient Jacobian.
+  virtual bool daeJacobian(double ttime, const double state[],
+                           const double dstate_dt[], double cj,
+                           JacobianEntries &entries, std::vector<int> &off) {
+    return false;
+  }
 };
 } // namespace CPS
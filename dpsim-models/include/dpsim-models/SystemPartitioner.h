@@ -0,0 +1,87 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <dpsim-models/Logger.h>
+#include <dpsim-models/SystemTopology.h>
+
+namespace CPS {
+/// Proposes a k-way split of a system for diakoptics or line decoupling.
+///
+/// Only candidate branches may be cut: components with a tear interface and a
+/// nonzero series impedance for tearing, or PiLines whose travelling time
+/// sqrt(LC) is at least the simulation time step for decoupling. Nodes joined
+/// by any other component always end up in the same subnet. The split is
+/// computed by recursive bisection with greedy graph growing and a boundary
+/// refinement, balancing the number of nodes per subnet while minimizing the
+/// number of cut branches. Among branches of equal count, tearing prefers
+/// cutting those with a high impedance.
+class SystemPartitioner {
+public:
+  enum class Mode { Tearing, Decoupling };
+
+  struct Partition {
+    /// Subnet of each node in SystemTopology::mNodes, -1 for ground nodes
+    std::vector<Int> nodeSubnet;
+    /// Number of nodes per subnet
+    std::vector<UInt> subnetSizes;
+    /// Branches between different subnets
+    IdentifiedObject::List cut;
+  };
+
+private:
+  SystemTopology &mSystem;
+  Mode mMode;
+  /// Simulation time step, lower bound for the delay of decoupling lines
+  Real mTimeStep;
+  /// Allowed relative deviation of a subnet size from the average
+  Real mImbalance = 0.05;
+  Logger::Log mSLog;
+
+  /// Edge of the graph between two groups of nodes
+  struct Edge {
+    UInt to;
+    Real cost;
+  };
+  /// Groups of nodes that must not be separated
+  std::vector<Int> mGroupOfNode;
+  std::vector<UInt> mGroupWeights;
+  std::vector<std::vector<Edge>> mAdjacency;
+  /// Candidate branches with the groups they connect
+  std::vector<std::pair<IdentifiedObject::Ptr, std::pair<UInt, UInt>>>
+      mCandidates;
+
+  /// Series impedance magnitude of a tearing candidate, zero if unknown
+  Real seriesImpedance(const IdentifiedObject::Ptr &comp);
+  /// Cost of cutting the component, zero if it is no candidate
+  Real cutCost(const IdentifiedObject::Ptr &comp,
+               const TopologicalNode::List &nodes, Real minImpedance);
+  /// Build the graph of node groups and candidate branches
+  void buildGraph();
+  /// Split the groups in set into numParts parts starting at firstPart
+  void bisect(const std::vector<UInt> &set, UInt numParts, UInt firstPart,
+              std::vector<Int> &part);
+
+public:
+  /// The time step is only used for decoupling
+  SystemPartitioner(SystemTopology &system, Mode mode, Real timeStep = 0,
+                    Logger::Level logLevel = Logger::Level::info);
+
+  /// Set the allowed relative deviation of a subnet size from the average
+  void setImbalance(Real imbalance) { mImbalance = imbalance; }
+
+  /// Propose a split into numSubnets subnets
+  Partition partition(UInt numSubnets);
+  /// Move the cut branches to the tear components of the system
+  void applyTearing(const Partition &partition);
+  /// Replace the cut lines by decoupling lines
+  void applyDecoupling(const Partition &partition,
+                       Logger::Level logLevel = Logger::Level::off);
+};
+} // namespace CPS
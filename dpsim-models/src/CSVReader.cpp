@@ -6,10 +6,248 @@
  * file, You can obtain one at https://mozilla.org/MPL/2.0/.
  *********************************************************************************/
 
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <numeric>
+#include <thread>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include <dpsim-models/CSVReader.h>
 
 using namespace CPS;
 
+namespace {
+/// Read-only view of a whole file which is memory-mapped where possible
+class MappedFile {
+public:
+  MappedFile(const fs::path &path) {
+#ifndef _WIN32
+    int fd = ::open(path.string().c_str(), O_RDONLY);
+    if (fd < 0)
+      throw std::runtime_error("Cannot open " + path.string());
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+      ::close(fd);
+      throw std::runtime_error("Cannot stat " + path.string());
+    }
+    mSize = static_cast<size_t>(st.st_size);
+    if (mSize > 0) {
+      void *addr = ::mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (addr == MAP_FAILED) {
+        ::close(fd);
+        throw std::runtime_error("Cannot map " + path.string());
+      }
+      ::madvise(addr, mSize, MADV_SEQUENTIAL);
+      mData = static_cast<const char *>(addr);
+    }
+    ::close(fd);
+#else
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+      throw std::runtime_error("Cannot open " + path.string());
+    mBuffer.assign(std::istreambuf_iterator<char>(file),
+                   std::istreambuf_iterator<char>());
+    mData = mBuffer.data();
+    mSize = mBuffer.size();
+#endif
+  }
+
+  ~MappedFile() {
+#ifndef _WIN32
+    if (mData)
+      ::munmap(const_cast<char *>(mData), mSize);
+#endif
+  }
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  const char *begin() const { return mData; }
+  const char *end() const { return mData + mSize; }
+
+private:
+  const char *mData = nullptr;
+  size_t mSize = 0;
+#ifdef _WIN32
+  String mBuffer;
+#endif
+};
+
+/// Numeric content of a csv file, stored row by row
+struct CSVTable {
+  std::vector<Real> values;
+  size_t columns = 0;
+
+  size_t rows() const { return columns ? values.size() / columns : 0; }
+  Real operator()(size_t row, size_t col) const {
+    return values[row * columns + col];
+  }
+};
+
+/// Parses a csv file of numbers in one pass over the mapped file. All rows
+/// need the same number of columns as the first one. Blank lines are ignored.
+CSVTable parseCSVTable(const fs::path &file, Bool skipTitle, Bool hhmmssTime) {
+  MappedFile mapped(file);
+  CSVTable table;
+  bool firstRow = true;
+  size_t lineNumber = 0;
+  const char *pos = mapped.begin();
+  const char *end = mapped.end();
+
+  while (pos < end) {
+    const char *eol =
+        static_cast<const char *>(std::memchr(pos, '\n', end - pos));
+    if (!eol)
+      eol = end;
+    const char *lineEnd = eol;
+    if (lineEnd > pos && lineEnd[-1] == '\r')
+      --lineEnd;
+    ++lineNumber;
+
+    const char *cur = pos;
+    pos = eol + 1;
+    while (cur < lineEnd && std::isspace(static_cast<unsigned char>(*cur)))
+      ++cur;
+    if (cur == lineEnd)
+      continue;
+
+    // Ignore the first row if it is a title
+    if (firstRow) {
+      firstRow = false;
+      if (skipTitle && !std::isdigit(static_cast<unsigned char>(*cur)))
+        continue;
+    }
+
+    size_t col = 0;
+    while (true) {
+      while (cur < lineEnd && std::isspace(static_cast<unsigned char>(*cur)))
+        ++cur;
+      const char *fieldEnd = static_cast<const char *>(
+          std::memchr(cur, ',', static_cast<size_t>(lineEnd - cur)));
+      if (!fieldEnd)
+        fieldEnd = lineEnd;
+
+      // strtod needs a terminated string, which the mapping is not
+      char field[64];
+      size_t len = std::min(static_cast<size_t>(fieldEnd - cur),
+                            sizeof(field) - 1);
+      std::memcpy(field, cur, len);
+      field[len] = '\0';
+
+      Real value = 0;
+      if (col == 0 && hhmmssTime) {
+        int hh, mm, ss = 0;
+        if (std::sscanf(field, "%d:%d:%d", &hh, &mm, &ss) >= 2)
+          value = hh * 3600 + mm * 60 + ss;
+      } else {
+        char *parsedEnd;
+        value = std::strtod(field, &parsedEnd);
+        if (parsedEnd == field)
+          throw std::invalid_argument(
+              file.string() + ":" + std::to_string(lineNumber) +
+              ": cannot parse '" + field + "' as a number");
+      }
+      table.values.push_back(value);
+      ++col;
+
+      if (fieldEnd == lineEnd)
+        break;
+      cur = fieldEnd + 1;
+    }
+
+    if (table.columns == 0)
+      table.columns = col;
+    else if (col != table.columns)
+      throw std::invalid_argument(file.string() + ":" +
+                                  std::to_string(lineNumber) + ": expected " +
+                                  std::to_string(table.columns) +
+                                  " columns but found " + std::to_string(col));
+  }
+  return table;
+}
+
+/// First and last row read by the row based readers. start_time skips
+/// that many rows, reading stops at the first row after end_time.
+void rowRange(size_t rows, Real start_time, Real end_time, size_t &first,
+              size_t &last) {
+  first = start_time < 0 ? 0 : static_cast<size_t>(Int(start_time));
+  last = rows - 1;
+  if (end_time > 0)
+    last = std::min(last, static_cast<size_t>(Int(end_time)) + 1);
+}
+
+Real lerp(Real a, Real b, Real frac) { return (1 - frac) * a + frac * b; }
+
+PQData lerp(const PQData &a, const PQData &b, Real frac) {
+  return {lerp(a.p, b.p, frac), lerp(a.q, b.q, frac)};
+}
+
+/// Stores the samples covering [first, last] on a uniform grid. The samples
+/// are kept if they are uniformly spaced, otherwise they are interpolated
+/// linearly onto a grid with the given step.
+template <typename T>
+void sampleOntoGrid(const std::vector<Real> &times,
+                    const std::vector<T> &samples, Real first, Real last,
+                    Real step, Real &gridStart, Real &gridStep,
+                    std::vector<T> &grid) {
+  size_t n = times.size();
+  if (n == 0)
+    return;
+
+  Real spacing = n > 1 ? times[1] - times[0] : step;
+  bool uniform = spacing > 0;
+  for (size_t i = 1; uniform && i + 1 < n; ++i)
+    uniform = std::abs(times[i + 1] - times[i] - spacing) <= 1e-9 * spacing;
+
+  if (uniform) {
+    // Keep the samples enclosing the requested interval
+    size_t lo = std::upper_bound(times.begin(), times.end(), first) -
+                times.begin();
+    lo = lo > 0 ? lo - 1 : 0;
+    size_t hi = std::lower_bound(times.begin(), times.end(), last) -
+                times.begin();
+    hi = std::min(std::max(hi, lo), n - 1);
+    gridStart = times[lo];
+    gridStep = spacing;
+    grid.assign(samples.begin() + lo, samples.begin() + hi + 1);
+    return;
+  }
+
+  if (!(step > 0))
+    throw std::invalid_argument("Load profile time step must be positive");
+
+  size_t count = static_cast<size_t>((last - first) / step + 1e-9) + 1;
+  gridStart = first;
+  gridStep = step;
+  grid.resize(count);
+  // Same interpolation as interpol_linear, but walking through the samples
+  size_t next = 0;
+  for (size_t k = 0; k < count; ++k) {
+    Real x = first + k * step;
+    while (next < n && times[next] <= x)
+      ++next;
+    if (next == n)
+      grid[k] = samples[n - 1];
+    else if (next == 0)
+      grid[k] = samples[0];
+    else
+      grid[k] = lerp(samples[next - 1], samples[next],
+                     (x - times[next - 1]) / (times[next] - times[next - 1]));
+  }
+}
+} // namespace
+
 MatrixRow CSVReader::csv2Eigen(const String &path) {
   std::ifstream inputFile;
   inputFile.open(path);
@@ -136,34 +374,22 @@ std::vector<PQData> CSVReader::readLoadProfileDP(fs::path file, Real start_time,
                                                  CSVReader::DataFormat format) {
 
   std::vector<PQData> load_profileDP;
-  std::ifstream csvfile(file);
-  CSVReaderIterator row_(csvfile);
-
-  // Ignore the first row if it is a title
-  if (mSkipFirstRow && !std::isdigit((*row_).get(0)[0])) {
-    row_.next();
-  }
-
-  /* Loop over rows of the csv file to find the entry point to read in.
-   * if start_time and end_time are negative (as default), it reads in all rows.
-   */
-  Real presentTime = 0;
-  for (; row_ != CSVReaderIterator(); row_.next()) {
-    if ((start_time < 0) | (Int(presentTime) + 1 > Int(start_time)))
-      break;
-    presentTime++;
-  }
-  // Reading data after entry point until end_time is reached.
-  for (; row_ != CSVReaderIterator(); row_.next()) {
+  CSVTable table = parseCSVTable(file, mSkipFirstRow, false);
+  if (table.rows() == 0)
+    return load_profileDP;
+  if (table.columns < 3)
+    throw std::invalid_argument(file.string() +
+                                ": expected time, P and Q columns");
+
+  size_t first, last;
+  rowRange(table.rows(), start_time, end_time, first, last);
+  for (size_t row = first; row <= last; ++row) {
     // IMPORTANT: take care of units. assume kW
     PQData pq;
     // multiplied by 1000 due to unit conversion (kw to w)
-    pq.p = std::stod((*row_).get(1)) * 1000 * scale_factor;
-    pq.q = std::stod((*row_).get(2)) * 1000 * scale_factor;
+    pq.p = table(row, 1) * 1000 * scale_factor;
+    pq.q = table(row, 2) * 1000 * scale_factor;
     load_profileDP.push_back(pq);
-    if (end_time > 0 && presentTime > end_time)
-      break;
-    presentTime = Int(presentTime) + 1;
   }
   std::cout << "CSV loaded." << std::endl;
   return load_profileDP;
@@ -174,72 +400,47 @@ PowerProfile CSVReader::readLoadProfile(fs::path file, Real start_time,
                                         CSVReader::DataFormat format) {
 
   PowerProfile load_profile;
-  std::ifstream csvfile(file);
-  bool need_that_conversion = (format == DataFormat::HHMMSS) ? true : false;
-  bool data_with_weighting_factor = false;
-
-  CSVReaderIterator loop(csvfile);
-
-  // ignore the first row if it is a title
-  if (mSkipFirstRow && !std::isdigit((*loop).get(0)[0])) {
-    loop.next();
-  }
-
-  /*
-   loop over rows of the csv file to find the entry point to read in.
-   and determine data type prior to read in. (assuming only time,p,q or time,weighting factor)
-   if start_time and end_time are negative (as default), it reads in all rows.
-  */
-  for (; loop != CSVReaderIterator(); loop.next()) {
-    CSVReaderIterator nextRow = loop;
-    nextRow.next();
-    CPS::Real nextTime = (need_that_conversion)
-                             ? time_format_convert((*nextRow).get(0))
-                             : std::stod((*nextRow).get(0));
-    if ((*nextRow).size() == 2) {
-      data_with_weighting_factor = true;
-    }
-    if ((start_time < 0) | (nextTime >= Int(start_time))) {
-      break;
-    }
-  }
-  /*
-   reading data after entry point until end_time is reached
-  */
-  for (; loop != CSVReaderIterator(); loop.next()) {
-    CPS::Real currentTime = (need_that_conversion)
-                                ? time_format_convert((*loop).get(0))
-                                : std::stod((*loop).get(0));
-    if (data_with_weighting_factor) {
-      Real wf = std::stod((*loop).get(1));
-      load_profile.weightingFactors.insert(
-          std::pair<Real, Real>(currentTime, wf));
-    } else {
-      PQData pq;
+  CSVTable table =
+      parseCSVTable(file, mSkipFirstRow, format == DataFormat::HHMMSS);
+  size_t rows = table.rows();
+  if (rows == 0)
+    return load_profile;
+  if (table.columns < 2)
+    throw std::invalid_argument(file.string() +
+                                ": expected time and data columns");
+  // assuming only time,p,q or time,weighting factor
+  bool data_with_weighting_factor = table.columns == 2;
+
+  // Sort the rows by time, as the previous map based profiles did
+  std::vector<size_t> order(rows);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&table](size_t a, size_t b) {
+    return table(a, 0) < table(b, 0);
+  });
+
+  std::vector<Real> times(rows);
+  for (size_t k = 0; k < rows; ++k)
+    times[k] = table(order[k], 0);
+
+  // if start_time and end_time are negative (as default), it reads in all rows.
+  Real first = start_time < 0 ? times.front() : start_time;
+  Real last = end_time < 0 ? times.back() : end_time;
+
+  if (data_with_weighting_factor) {
+    std::vector<Real> wf(rows);
+    for (size_t k = 0; k < rows; ++k)
+      wf[k] = table(order[k], 1);
+    sampleOntoGrid(times, wf, first, last, time_step, load_profile.gridStart,
+                   load_profile.gridStep, load_profile.weightingFactorGrid);
+  } else {
+    std::vector<PQData> pq(rows);
+    for (size_t k = 0; k < rows; ++k) {
       // multiplied by 1000 due to unit conversion (kw to w)
-      pq.p = std::stod((*loop).get(1)) * 1000;
-      pq.q = std::stod((*loop).get(2)) * 1000;
-      load_profile.pqData.insert(std::pair<Real, PQData>(currentTime, pq));
-    }
-
-    if (end_time > 0 && currentTime > end_time)
-      break;
-  }
-  std::vector<CPS::Real> times;
-  for (CPS::Real x_ = start_time; x_ <= end_time; x_ += time_step) {
-    times.push_back(x_);
-  }
-
-  for (auto x : times) {
-    if (load_profile.pqData.find(x) == load_profile.pqData.end()) {
-      if (data_with_weighting_factor) {
-        Real y = interpol_linear(load_profile.weightingFactors, x);
-        load_profile.weightingFactors.insert(std::pair<Real, Real>(x, y));
-      } else {
-        PQData y = interpol_linear(load_profile.pqData, x);
-        load_profile.pqData.insert(std::pair<Real, PQData>(x, y));
-      }
+      pq[k].p = table(order[k], 1) * 1000;
+      pq[k].q = table(order[k], 2) * 1000;
     }
+    sampleOntoGrid(times, pq, first, last, time_step, load_profile.gridStart,
+                   load_profile.gridStep, load_profile.pqGrid);
   }
 
   return load_profile;
@@ -251,41 +452,65 @@ std::vector<Real> CSVReader::readPQData(fs::path file, Real start_time,
                                         CSVReader::DataFormat format) {
 
   std::vector<Real> p_data;
-  std::ifstream csvfile(file);
-  CSVReaderIterator row_(csvfile);
-
-  // ignore the first row if it is a title
-  if (mSkipFirstRow && !std::isdigit((*row_).get(0)[0])) {
-    row_.next();
-  }
+  CSVTable table = parseCSVTable(file, mSkipFirstRow, false);
+  if (table.rows() == 0)
+    return p_data;
 
-  /*
-   loop over rows of the csv file to find the entry point to read in.
-   if start_time and end_time are negative (as default), it reads in all rows.
-  */
-  Real presentTime = 0;
-  for (; row_ != CSVReaderIterator(); row_.next()) {
-    if ((start_time < 0) | (Int(presentTime) + 1 > Int(start_time)))
-      break;
-    presentTime++;
-  }
-  // Reading data after entry point until end_time is reached.
-  for (; row_ != CSVReaderIterator(); row_.next()) {
+  size_t first, last;
+  rowRange(table.rows(), start_time, end_time, first, last);
+  for (size_t row = first; row <= last; ++row) {
     // IMPORTANT: take care of units. assume kW
-    p_data.push_back(std::stod((*row_).get(0)) * 1000);
-    if (end_time > 0 && presentTime > end_time)
-      break;
-    presentTime = Int(presentTime) + 1;
+    p_data.push_back(table(row, 0) * 1000);
   }
   std::cout << "CSV loaded." << std::endl;
   return p_data;
 }
 
+void CSVReader::readLoadProfiles(
+    std::vector<std::pair<std::shared_ptr<SP::Ph1::Load>, fs::path>> &jobs,
+    Real start_time, Real time_step, Real end_time,
+    CSVReader::DataFormat format) {
+
+  size_t numThreads =
+      mNumThreads > 0 ? mNumThreads : std::thread::hardware_concurrency();
+  numThreads = std::max<size_t>(1, std::min(numThreads, jobs.size()));
+
+  std::atomic<size_t> next(0);
+  std::exception_ptr error;
+  std::mutex errorMutex;
+
+  auto worker = [&]() {
+    for (size_t k = next++; k < jobs.size(); k = next++) {
+      try {
+        jobs[k].first->mLoadProfile = readLoadProfile(
+            jobs[k].second, start_time, time_step, end_time, format);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(errorMutex);
+        if (!error)
+          error = std::current_exception();
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < numThreads; ++i)
+    threads.emplace_back(worker);
+  worker();
+  for (auto &thread : threads)
+    thread.join();
+
+  if (error)
+    std::rethrow_exception(error);
+}
+
 void CSVReader::assignLoadProfile(CPS::SystemTopology &sys, Real start_time,
                                   Real time_step, Real end_time,
                                   CSVReader::Mode mode,
                                   CSVReader::DataFormat format) {
 
+  // Profiles are matched first and then read in parallel
+  std::vector<std::pair<std::shared_ptr<SP::Ph1::Load>, fs::path>> jobs;
+
   switch (mode) {
   case CSVReader::Mode::AUTO: {
     for (auto obj : sys.mComponents) {
@@ -310,15 +535,17 @@ void CSVReader::assignLoadProfile(CPS::SystemTopology &sys, Real start_time,
                           file_name.end());
           if (std::string(file_name.begin(), file_name.end() - 3)
                   .compare(load_name) == 0) {
-            load->mLoadProfile =
-                readLoadProfile(file, start_time, time_step, end_time, format);
-            load->use_profile = true;
-            SPDLOG_LOGGER_INFO(mSLog, "Assigned {} to {}",
-                               file.filename().string(), load->name());
+            jobs.emplace_back(load, file);
           }
         }
       }
     }
+    readLoadProfiles(jobs, start_time, time_step, end_time, format);
+    for (auto &job : jobs) {
+      job.first->use_profile = true;
+      SPDLOG_LOGGER_INFO(mSLog, "Assigned {} to {}",
+                         job.second.filename().string(), job.first->name());
+    }
     break;
   }
   case CSVReader::Mode::MANUAL: {
@@ -337,17 +564,18 @@ void CSVReader::assignLoadProfile(CPS::SystemTopology &sys, Real start_time,
           LP_not_assigned_counter++;
           continue;
         }
-        load->mLoadProfile =
-            readLoadProfile(fs::path(mPath + file->second + ".csv"), start_time,
-                            time_step, end_time);
-        load->use_profile = true;
-        std::cout << " Assigned " << file->second << " to " << load->name()
-                  << std::endl;
-        SPDLOG_LOGGER_INFO(mSLog, "Assigned {}.csv to {}", file->second,
-                           load->name());
-        LP_assigned_counter++;
+        jobs.emplace_back(load, fs::path(mPath + file->second + ".csv"));
       }
     }
+    readLoadProfiles(jobs, start_time, time_step, end_time, format);
+    for (auto &job : jobs) {
+      job.first->use_profile = true;
+      std::cout << " Assigned " << job.second.stem().string() << " to "
+                << job.first->name() << std::endl;
+      SPDLOG_LOGGER_INFO(mSLog, "Assigned {} to {}",
+                         job.second.filename().string(), job.first->name());
+      LP_assigned_counter++;
+    }
     SPDLOG_LOGGER_INFO(mSLog,
                        "Assigned profiles for {} loads, {} not assigned.",
                        LP_assigned_counter, LP_not_assigned_counter);
@@ -153,17 +153,17 @@ void DP::Ph1::Capacitor::mnaCompApplyRightSideVectorStamp(Matrix &rightVector) {
       Math::setVectorElement(rightVector, matrixNodeIndex(1),
                              -mEquivCurrent(freq, 0), mNumFreqs, freq);
 
-    SPDLOG_LOGGER_DEBUG(mSLog, "MNA EquivCurrent {:f}+j{:f}",
-                        mEquivCurrent(freq, 0).real(),
-                        mEquivCurrent(freq, 0).imag());
+    CPS_STEP_LOG_DEBUG(mSLog, "MNA EquivCurrent {:f}+j{:f}",
+                       mEquivCurrent(freq, 0).real(),
+                       mEquivCurrent(freq, 0).imag());
     if (terminalNotGrounded(0))
-      SPDLOG_LOGGER_DEBUG(mSLog, "Add {:f}+j{:f} to source vector at {:d}",
-                          mEquivCurrent(freq, 0).real(),
-                          mEquivCurrent(freq, 0).imag(), matrixNodeIndex(0));
+      CPS_STEP_LOG_DEBUG(mSLog, "Add {:f}+j{:f} to source vector at {:d}",
+                         mEquivCurrent(freq, 0).real(),
+                         mEquivCurrent(freq, 0).imag(), matrixNodeIndex(0));
     if (terminalNotGrounded(1))
-      SPDLOG_LOGGER_DEBUG(mSLog, "Add {:f}+j{:f} to source vector at {:d}",
-                          -mEquivCurrent(freq, 0).real(),
-                          -mEquivCurrent(freq, 0).imag(), matrixNodeIndex(1));
+      CPS_STEP_LOG_DEBUG(mSLog, "Add {:f}+j{:f} to source vector at {:d}",
+                         -mEquivCurrent(freq, 0).real(),
+                         -mEquivCurrent(freq, 0).imag(), matrixNodeIndex(1));
   }
 }
 
@@ -254,9 +254,9 @@ void DP::Ph1::Capacitor::mnaCompUpdateVoltage(const Matrix &leftVector) {
           Math::complexFromVectorElement(leftVector, matrixNodeIndex(0),
                                          mNumFreqs, freq);
 
-    SPDLOG_LOGGER_DEBUG(mSLog, "Voltage {:e}<{:e}",
-                        std::abs((**mIntfVoltage)(0, freq)),
-                        std::arg((**mIntfVoltage)(0, freq)));
+    CPS_STEP_LOG_DEBUG(mSLog, "Voltage {:e}<{:e}",
+                       std::abs((**mIntfVoltage)(0, freq)),
+                       std::arg((**mIntfVoltage)(0, freq)));
   }
 }
 
@@ -272,8 +272,8 @@ void DP::Ph1::Capacitor::mnaCompUpdateVoltageHarm(const Matrix &leftVector,
         (**mIntfVoltage)(0, freqIdx) -
         Math::complexFromVectorElement(leftVector, matrixNodeIndex(0));
 
-  SPDLOG_LOGGER_DEBUG(mSLog, "Voltage {:s}",
-                      Logger::phasorToString((**mIntfVoltage)(0, freqIdx)));
+  CPS_STEP_LOG_DEBUG(mSLog, "Voltage {:s}",
+                     Logger::phasorToString((**mIntfVoltage)(0, freqIdx)));
 }
 
 void DP::Ph1::Capacitor::mnaCompUpdateCurrent(const Matrix &leftVector) {
@@ -281,8 +281,8 @@ void DP::Ph1::Capacitor::mnaCompUpdateCurrent(const Matrix &leftVector) {
     (**mIntfCurrent)(0, freq) =
         mEquivCond(freq, 0) * (**mIntfVoltage)(0, freq) +
         mEquivCurrent(freq, 0);
-    SPDLOG_LOGGER_DEBUG(mSLog, "Current {:s}",
-                        Logger::phasorToString((**mIntfCurrent)(0, freq)));
+    CPS_STEP_LOG_DEBUG(mSLog, "Current {:s}",
+                       Logger::phasorToString((**mIntfCurrent)(0, freq)));
   }
 }
 
@@ -291,7 +291,7 @@ void DP::Ph1::Capacitor::mnaCompUpdateCurrentHarm() {
     (**mIntfCurrent)(0, freq) =
         mEquivCond(freq, 0) * (**mIntfVoltage)(0, freq) +
         mEquivCurrent(freq, 0);
-    SPDLOG_LOGGER_DEBUG(mSLog, "Current {:s}",
-                        Logger::phasorToString((**mIntfCurrent)(0, freq)));
+    CPS_STEP_LOG_DEBUG(mSLog, "Current {:s}",
+                       Logger::phasorToString((**mIntfCurrent)(0, freq)));
   }
 }
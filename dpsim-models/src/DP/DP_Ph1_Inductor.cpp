@@ -140,16 +140,16 @@ void DP::Ph1::Inductor::mnaCompApplyRightSideVectorStamp(Matrix &rightVector) {
       Math::setVectorElement(rightVector, matrixNodeIndex(1),
                              -mEquivCurrent(freq, 0), mNumFreqs, freq);
 
-    SPDLOG_LOGGER_DEBUG(mSLog, "MNA EquivCurrent {:s}",
-                        Logger::complexToString(mEquivCurrent(freq, 0)));
+    CPS_STEP_LOG_DEBUG(mSLog, "MNA EquivCurrent {:s}",
+                       Logger::complexToString(mEquivCurrent(freq, 0)));
     if (terminalNotGrounded(0))
-      SPDLOG_LOGGER_DEBUG(mSLog, "Add {:s} to source vector at {:d}",
-                          Logger::complexToString(mEquivCurrent(freq, 0)),
-                          matrixNodeIndex(0));
+      CPS_STEP_LOG_DEBUG(mSLog, "Add {:s} to source vector at {:d}",
+                         Logger::complexToString(mEquivCurrent(freq, 0)),
+                         matrixNodeIndex(0));
     if (terminalNotGrounded(1))
-      SPDLOG_LOGGER_DEBUG(mSLog, "Add {:s} to source vector at {:d}",
-                          Logger::complexToString(-mEquivCurrent(freq, 0)),
-                          matrixNodeIndex(1));
+      CPS_STEP_LOG_DEBUG(mSLog, "Add {:s} to source vector at {:d}",
+                         Logger::complexToString(-mEquivCurrent(freq, 0)),
+                         matrixNodeIndex(1));
   }
 }
 
@@ -222,8 +222,8 @@ void DP::Ph1::Inductor::mnaCompUpdateVoltage(const Matrix &leftVector) {
           Math::complexFromVectorElement(leftVector, matrixNodeIndex(0),
                                          mNumFreqs, freq);
 
-    SPDLOG_LOGGER_DEBUG(mSLog, "Voltage {:s}",
-                        Logger::phasorToString((**mIntfVoltage)(0, freq)));
+    CPS_STEP_LOG_DEBUG(mSLog, "Voltage {:s}",
+                       Logger::phasorToString((**mIntfVoltage)(0, freq)));
   }
 }
 
@@ -239,8 +239,8 @@ void DP::Ph1::Inductor::mnaCompUpdateVoltageHarm(const Matrix &leftVector,
         (**mIntfVoltage)(0, freqIdx) -
         Math::complexFromVectorElement(leftVector, matrixNodeIndex(0));
 
-  SPDLOG_LOGGER_DEBUG(mSLog, "Voltage {:s}",
-                      Logger::phasorToString((**mIntfVoltage)(0, freqIdx)));
+  CPS_STEP_LOG_DEBUG(mSLog, "Voltage {:s}",
+                     Logger::phasorToString((**mIntfVoltage)(0, freqIdx)));
 }
 
 void DP::Ph1::Inductor::mnaCompUpdateCurrent(const Matrix &leftVector) {
@@ -248,8 +248,8 @@ void DP::Ph1::Inductor::mnaCompUpdateCurrent(const Matrix &leftVector) {
     (**mIntfCurrent)(0, freq) =
         mEquivCond(freq, 0) * (**mIntfVoltage)(0, freq) +
         mEquivCurrent(freq, 0);
-    SPDLOG_LOGGER_DEBUG(mSLog, "Current {:s}",
-                        Logger::phasorToString((**mIntfCurrent)(0, freq)));
+    CPS_STEP_LOG_DEBUG(mSLog, "Current {:s}",
+                       Logger::phasorToString((**mIntfCurrent)(0, freq)));
   }
 }
 
@@ -258,8 +258,8 @@ void DP::Ph1::Inductor::mnaCompUpdateCurrentHarm() {
     (**mIntfCurrent)(0, freq) =
         mEquivCond(freq, 0) * (**mIntfVoltage)(0, freq) +
         mEquivCurrent(freq, 0);
-    SPDLOG_LOGGER_DEBUG(mSLog, "Current {:s}",
-                        Logger::phasorToString((**mIntfCurrent)(0, freq)));
+    CPS_STEP_LOG_DEBUG(mSLog, "Current {:s}",
+                       Logger::phasorToString((**mIntfCurrent)(0, freq)));
   }
 }
 
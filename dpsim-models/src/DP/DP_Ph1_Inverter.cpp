@@ -104,12 +104,12 @@ void DP::Ph1::Inverter::calculatePhasors() {
                        cos(mCarHarms[h] * PI / 2.));
   }
 
-  SPDLOG_LOGGER_DEBUG(mSLog,
-                      "\n--- Phasor calculation ---"
-                      "\n{}"
-                      "\n{}"
-                      "\n--- Phasor calculation end ---",
-                      mPhasorMags, **mIntfVoltage);
+  CPS_STEP_LOG_DEBUG(mSLog,
+                     "\n--- Phasor calculation ---"
+                     "\n{}"
+                     "\n{}"
+                     "\n--- Phasor calculation end ---",
+                     mPhasorMags, **mIntfVoltage);
 }
 
 // #### MNA functions ####
@@ -178,23 +178,23 @@ void DP::Ph1::Inverter::mnaCompApplySystemMatrixStampHarm(
 }
 
 void DP::Ph1::Inverter::mnaCompApplyRightSideVectorStamp(Matrix &rightVector) {
-  SPDLOG_LOGGER_DEBUG(mSLog, "Stamp harmonics into source vector");
+  CPS_STEP_LOG_DEBUG(mSLog, "Stamp harmonics into source vector");
   for (UInt freq = 0; freq < mNumFreqs; freq++) {
     if (terminalNotGrounded(0)) {
       Math::setVectorElement(rightVector, mVirtualNodes[0]->matrixNodeIndex(),
                              (**mIntfVoltage)(0, freq), mNumFreqs, freq);
 
-      SPDLOG_LOGGER_DEBUG(mSLog,
-                          "Add {:s} to source vector at {:d}, harmonic {:d}",
-                          Logger::complexToString((**mIntfVoltage)(0, freq)),
-                          mVirtualNodes[0]->matrixNodeIndex(), freq);
+      CPS_STEP_LOG_DEBUG(mSLog,
+                         "Add {:s} to source vector at {:d}, harmonic {:d}",
+                         Logger::complexToString((**mIntfVoltage)(0, freq)),
+                         mVirtualNodes[0]->matrixNodeIndex(), freq);
     }
   }
 }
 
 void DP::Ph1::Inverter::mnaCompApplyRightSideVectorStampHarm(
     Matrix &rightVector) {
-  SPDLOG_LOGGER_DEBUG(mSLog, "Stamp harmonics into source vector");
+  CPS_STEP_LOG_DEBUG(mSLog, "Stamp harmonics into source vector");
   for (UInt freq = 0; freq < mNumFreqs; freq++) {
     if (terminalNotGrounded(0)) {
       Math::setVectorElement(rightVector, mVirtualNodes[0]->matrixNodeIndex(),
@@ -110,8 +110,8 @@ void DP::Ph1::NetworkInjection::initializeFromNodesAndTerminals(
 
 void DP::Ph1::NetworkInjection::mnaParentApplyRightSideVectorStamp(
     Matrix &rightVector) {
-  SPDLOG_LOGGER_DEBUG(mSLog, "Right Side Vector: {:s}",
-                      Logger::matrixToString(rightVector));
+  CPS_STEP_LOG_DEBUG(mSLog, "Right Side Vector: {:s}",
+                     Logger::matrixToString(rightVector));
 }
 
 void DP::Ph1::NetworkInjection::mnaParentAddPreStepDependencies(
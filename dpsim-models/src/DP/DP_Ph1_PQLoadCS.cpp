@@ -96,12 +96,12 @@ void DP::Ph1::PQLoadCS::updateSetPoint() {
   //Complex current = power / (**mIntfVoltage)(0,0);
 
   **mSubCurrentSource->mCurrentRef = std::conj(current);
-  SPDLOG_LOGGER_DEBUG(mSLog,
-                      "\n--- update set points ---"
-                      "\npower: {:s}"
-                      "\nCurrent: {:s}",
-                      Logger::phasorToString(power),
-                      Logger::phasorToString(std::conj(current)));
+  CPS_STEP_LOG_DEBUG(mSLog,
+                     "\n--- update set points ---"
+                     "\npower: {:s}"
+                     "\nCurrent: {:s}",
+                     Logger::phasorToString(power),
+                     Logger::phasorToString(std::conj(current)));
 }
 
 void DP::Ph1::PQLoadCS::mnaParentAddPreStepDependencies(
@@ -235,9 +235,9 @@ void DP::Ph1::ProfileVoltageSource::mnaCompApplyRightSideVectorStamp(
   // TODO: Is this correct with two nodes not gnd?
   Math::setVectorElement(rightVector, mVirtualNodes[0]->matrixNodeIndex(),
                          (**mIntfVoltage)(0, 0), mNumFreqs);
-  SPDLOG_LOGGER_DEBUG(mSLog, "Add {:s} to source vector at {:d}",
-                      Logger::complexToString((**mIntfVoltage)(0, 0)),
-                      mVirtualNodes[0]->matrixNodeIndex());
+  CPS_STEP_LOG_DEBUG(mSLog, "Add {:s} to source vector at {:d}",
+                     Logger::complexToString((**mIntfVoltage)(0, 0)),
+                     mVirtualNodes[0]->matrixNodeIndex());
 }
 
 void DP::Ph1::ProfileVoltageSource::mnaCompApplyRightSideVectorStampHarm(
@@ -246,9 +246,9 @@ void DP::Ph1::ProfileVoltageSource::mnaCompApplyRightSideVectorStampHarm(
     // TODO: Is this correct with two nodes not gnd?
     Math::setVectorElement(rightVector, mVirtualNodes[0]->matrixNodeIndex(),
                            (**mIntfVoltage)(0, freq), 1, 0, freq);
-    SPDLOG_LOGGER_DEBUG(mSLog, "Add {:s} to source vector at {:d}",
-                        Logger::complexToString((**mIntfVoltage)(0, freq)),
-                        mVirtualNodes[0]->matrixNodeIndex());
+    CPS_STEP_LOG_DEBUG(mSLog, "Add {:s} to source vector at {:d}",
+                       Logger::complexToString((**mIntfVoltage)(0, freq)),
+                       mVirtualNodes[0]->matrixNodeIndex());
   }
 }
 
@@ -127,16 +127,16 @@ void DP::Ph1::Resistor::mnaCompUpdateVoltage(const Matrix &leftVector) {
           Math::complexFromVectorElement(leftVector, matrixNodeIndex(0),
                                          mNumFreqs, freq);
 
-    SPDLOG_LOGGER_DEBUG(mSLog, "Voltage {:s}",
-                        Logger::phasorToString((**mIntfVoltage)(0, freq)));
+    CPS_STEP_LOG_DEBUG(mSLog, "Voltage {:s}",
+                       Logger::phasorToString((**mIntfVoltage)(0, freq)));
   }
 }
 
 void DP::Ph1::Resistor::mnaCompUpdateCurrent(const Matrix &leftVector) {
   for (UInt freq = 0; freq < mNumFreqs; freq++) {
     (**mIntfCurrent)(0, freq) = (**mIntfVoltage)(0, freq) / **mResistance;
-    SPDLOG_LOGGER_DEBUG(mSLog, "Current {:s}",
-                        Logger::phasorToString((**mIntfCurrent)(0, freq)));
+    CPS_STEP_LOG_DEBUG(mSLog, "Current {:s}",
+                       Logger::phasorToString((**mIntfCurrent)(0, freq)));
   }
 }
 
@@ -152,15 +152,15 @@ void DP::Ph1::Resistor::mnaCompUpdateVoltageHarm(const Matrix &leftVector,
         (**mIntfVoltage)(0, freqIdx) -
         Math::complexFromVectorElement(leftVector, matrixNodeIndex(0));
 
-  SPDLOG_LOGGER_DEBUG(mSLog, "Voltage {:s}",
-                      Logger::phasorToString((**mIntfVoltage)(0, freqIdx)));
+  CPS_STEP_LOG_DEBUG(mSLog, "Voltage {:s}",
+                     Logger::phasorToString((**mIntfVoltage)(0, freqIdx)));
 }
 
 void DP::Ph1::Resistor::mnaCompUpdateCurrentHarm() {
   for (UInt freq = 0; freq < mNumFreqs; freq++) {
     (**mIntfCurrent)(0, freq) = (**mIntfVoltage)(0, freq) / **mResistance;
-    SPDLOG_LOGGER_DEBUG(mSLog, "Current {:s}",
-                        Logger::phasorToString((**mIntfCurrent)(0, freq)));
+    CPS_STEP_LOG_DEBUG(mSLog, "Current {:s}",
+                       Logger::phasorToString((**mIntfCurrent)(0, freq)));
   }
 }
 
@@ -190,3 +190,22 @@ void DP::Ph1::Resistor::daeResidual(double ttime, const double state[],
 }
 
 Complex DP::Ph1::Resistor::daeInitialize() { return (**mIntfVoltage)(0, 0); }
+
+bool DP::Ph1::Resistor::daeJacobian(double ttime, const double state[],
+                                    const double dstate_dt[], double cj,
+                                    JacobianEntries &entries,
+                                    std::vector<int> &off) {
+  int Pos1 = matrixNodeIndex(0);
+  int Pos2 = matrixNodeIndex(1);
+  int c_offset = off[0] + off[1];
+  // Ground nodes have no state
+  if (Pos2 >= 0)
+    entries.emplace_back(c_offset, Pos2, 1.);
+  if (Pos1 >= 0)
+    entries.emplace_back(c_offset, Pos1, -1.);
+  entries.emplace_back(c_offset, c_offset, -1.);
+  entries.emplace_back(c_offset + Pos1 + 1, c_offset, 1.0 / **mResistance);
+  entries.emplace_back(c_offset + Pos2 + 1, c_offset, 1.0 / **mResistance);
+  off[1] += 1;
+  return true;
+}
@@ -160,8 +160,8 @@ void DP::Ph1::SynchronGenerator4OrderTPM::stepInPerUnit() {
   mResistanceMatrixVarying(0, 1) = (mA + mB) / 2.0 * cos(2 * DeltaTheta);
   mResistanceMatrixVarying(1, 0) = (mA + mB) / 2.0 * cos(2 * DeltaTheta);
   mResistanceMatrixVarying(1, 1) = (mA + mB) / 2.0 * sin(2 * DeltaTheta);
-  SPDLOG_LOGGER_DEBUG(mSLog, "\nR_var [pu] (t={:f}): {:s}", mSimTime,
-                      Logger::matrixToString(mResistanceMatrixVarying));
+  CPS_STEP_LOG_DEBUG(mSLog, "\nR_var [pu] (t={:f}): {:s}", mSimTime,
+                     Logger::matrixToString(mResistanceMatrixVarying));
 
   // predict stator current (linear extrapolation)
   Matrix IdpPrediction = Matrix::Zero(2, 1);
@@ -298,6 +298,6 @@ void DP::Ph1::Transformer::mnaCompUpdateVoltage(const Matrix &leftVector) {
   (**mIntfVoltage)(0, 0) = (**mIntfVoltage)(0, 0) -
                            Math::complexFromVectorElement(
                                leftVector, mVirtualNodes[0]->matrixNodeIndex());
-  SPDLOG_LOGGER_DEBUG(mSLog, "Voltage {:s}",
-                      Logger::phasorToString((**mIntfVoltage)(0, 0)));
+  CPS_STEP_LOG_DEBUG(mSLog, "Voltage {:s}",
+                     Logger::phasorToString((**mIntfVoltage)(0, 0)));
 }
@@ -223,9 +223,9 @@ void DP::Ph1::VoltageSource::mnaCompApplyRightSideVectorStamp(
   // TODO: Is this correct with two nodes not gnd?
   Math::setVectorElement(rightVector, mVirtualNodes[0]->matrixNodeIndex(),
                          (**mIntfVoltage)(0, 0), mNumFreqs);
-  SPDLOG_LOGGER_DEBUG(mSLog, "Add {:s} to source vector at {:d}",
-                      Logger::complexToString((**mIntfVoltage)(0, 0)),
-                      mVirtualNodes[0]->matrixNodeIndex());
+  CPS_STEP_LOG_DEBUG(mSLog, "Add {:s} to source vector at {:d}",
+                     Logger::complexToString((**mIntfVoltage)(0, 0)),
+                     mVirtualNodes[0]->matrixNodeIndex());
 }
 
 void DP::Ph1::VoltageSource::mnaCompApplyRightSideVectorStampHarm(
@@ -234,9 +234,9 @@ void DP::Ph1::VoltageSource::mnaCompApplyRightSideVectorStampHarm(
     // TODO: Is this correct with two nodes not gnd?
     Math::setVectorElement(rightVector, mVirtualNodes[0]->matrixNodeIndex(),
                            (**mIntfVoltage)(0, freq), 1, 0, freq);
-    SPDLOG_LOGGER_DEBUG(mSLog, "Add {:s} to source vector at {:d}",
-                        Logger::complexToString((**mIntfVoltage)(0, freq)),
-                        mVirtualNodes[0]->matrixNodeIndex());
+    CPS_STEP_LOG_DEBUG(mSLog, "Add {:s} to source vector at {:d}",
+                       Logger::complexToString((**mIntfVoltage)(0, freq)),
+                       mVirtualNodes[0]->matrixNodeIndex());
   }
 }
 
@@ -249,8 +249,8 @@ void DP::Ph1::VoltageSource::updateVoltage(Real time) {
                       "generator is configured!");
   }
 
-  SPDLOG_LOGGER_DEBUG(mSLog, "Update Voltage {:s}",
-                      Logger::phasorToString((**mIntfVoltage)(0, 0)));
+  CPS_STEP_LOG_DEBUG(mSLog, "Update Voltage {:s}",
+                     Logger::phasorToString((**mIntfVoltage)(0, 0)));
 }
 
 void DP::Ph1::VoltageSource::mnaCompPreStep(Real time, Int timeStepCount) {
@@ -317,3 +317,21 @@ Complex DP::Ph1::VoltageSource::daeInitialize() {
   (**mIntfVoltage)(0, 0) = mSrcSig->getSignal();
   return mSrcSig->getSignal();
 }
+
+bool DP::Ph1::VoltageSource::daeJacobian(double ttime, const double state[],
+                                         const double dstate_dt[], double cj,
+                                         JacobianEntries &entries,
+                                         std::vector<int> &off) {
+  // The current injections into the nodal equations do not depend on the
+  // state, only the voltage equation contributes
+  int Pos1 = matrixNodeIndex(0);
+  int Pos2 = matrixNodeIndex(1);
+  int c_offset = off[0] + off[1];
+  if (Pos2 >= 0)
+    entries.emplace_back(c_offset, Pos2, 1.);
+  if (Pos1 >= 0)
+    entries.emplace_back(c_offset, Pos1, -1.);
+  entries.emplace_back(c_offset, c_offset, -1.);
+  off[1] += 1;
+  return true;
+}
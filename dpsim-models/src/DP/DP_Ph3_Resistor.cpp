@@ -103,17 +103,17 @@ void DP::Ph3::Resistor::mnaCompUpdateVoltage(const Matrix &leftVector) {
         Math::complexFromVectorElement(leftVector, matrixNodeIndex(0, 2));
   }
 
-  SPDLOG_LOGGER_DEBUG(mSLog, "Voltage A: {} < {}",
-                      std::abs((**mIntfVoltage)(0, 0)),
-                      std::arg((**mIntfVoltage)(0, 0)));
+  CPS_STEP_LOG_DEBUG(mSLog, "Voltage A: {} < {}",
+                     std::abs((**mIntfVoltage)(0, 0)),
+                     std::arg((**mIntfVoltage)(0, 0)));
 }
 
 void DP::Ph3::Resistor::mnaCompUpdateCurrent(const Matrix &leftVector) {
   **mIntfCurrent = (**mResistance).inverse() * **mIntfVoltage;
-  SPDLOG_LOGGER_DEBUG(mSLog, "Current A: {} < {}",
+  CPS_STEP_LOG_DEBUG(mSLog, "Current A: {} < {}",
 
-                      std::abs((**mIntfCurrent)(0, 0)),
-                      std::arg((**mIntfCurrent)(0, 0)));
+                     std::abs((**mIntfCurrent)(0, 0)),
+                     std::arg((**mIntfCurrent)(0, 0)));
 }
 
 // #### Tear Methods ####
@@ -141,7 +141,7 @@ void EMT::Ph1::SSN::Full_Serial_RLC::mnaCompApplyRightSideVectorStamp(
   if (terminalNotGrounded(1)) {
     Math::setVectorElement(rightVector, matrixNodeIndex(1, 0), -mYHistory);
   }
-  SPDLOG_LOGGER_DEBUG(
+  CPS_STEP_LOG_DEBUG(
       mSLog, "\nHistory current term (mnaCompApplyRightSideVectorStamp): {:s}",
       Logger::matrixToString(mYHistory));
 }
@@ -192,16 +192,16 @@ void EMT::Ph1::SSN::Full_Serial_RLC::mnaCompUpdateVoltage(
         (**mIntfVoltage)(0, 0) -
         Math::realFromVectorElement(leftVector, matrixNodeIndex(0, 0));
   }
-  SPDLOG_LOGGER_DEBUG(mSLog, "\nUpdate Voltage: {:s}",
-                      Logger::matrixToString(**mIntfVoltage));
+  CPS_STEP_LOG_DEBUG(mSLog, "\nUpdate Voltage: {:s}",
+                     Logger::matrixToString(**mIntfVoltage));
 }
 
 void EMT::Ph1::SSN::Full_Serial_RLC::mnaCompUpdateCurrent(
     const Matrix &leftVector) {
   (**mIntfCurrent)(0, 0) = mYHistory + (mDufourWKN * **mIntfVoltage)(0, 0);
 
-  SPDLOG_LOGGER_DEBUG(mSLog, "\nUpdate Current: {:s}",
-                      Logger::matrixToString(**mIntfCurrent));
+  CPS_STEP_LOG_DEBUG(mSLog, "\nUpdate Current: {:s}",
+                     Logger::matrixToString(**mIntfCurrent));
 }
 
 void EMT::Ph1::SSN::Full_Serial_RLC::setParameters(Real resistance,
@@ -103,8 +103,8 @@ void EMT::Ph3::Capacitor::mnaCompApplyRightSideVectorStamp(
     Math::setVectorElement(rightVector, matrixNodeIndex(1, 2),
                            -mEquivCurrent(2, 0));
   }
-  SPDLOG_LOGGER_DEBUG(mSLog, "\nEquivalent Current: {:s}",
-                      Logger::matrixToString(mEquivCurrent));
+  CPS_STEP_LOG_DEBUG(mSLog, "\nEquivalent Current: {:s}",
+                     Logger::matrixToString(mEquivCurrent));
 }
 
 void EMT::Ph3::Capacitor::mnaCompAddPreStepDependencies(
@@ -163,6 +163,6 @@ void EMT::Ph3::Capacitor::mnaCompUpdateVoltage(const Matrix &leftVector) {
 
 void EMT::Ph3::Capacitor::mnaCompUpdateCurrent(const Matrix &leftVector) {
   **mIntfCurrent = mEquivCond * **mIntfVoltage + mEquivCurrent;
-  SPDLOG_LOGGER_DEBUG(mSLog, "\nCurrent: {:s}",
-                      Logger::matrixToString(**mIntfCurrent));
+  CPS_STEP_LOG_DEBUG(mSLog, "\nCurrent: {:s}",
+                     Logger::matrixToString(**mIntfCurrent));
 }
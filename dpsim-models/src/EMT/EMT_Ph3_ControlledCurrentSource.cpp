@@ -90,8 +90,8 @@ void EMT::Ph3::ControlledCurrentSource::mnaCompApplyRightSideVectorStamp(
 void EMT::Ph3::ControlledCurrentSource::updateCurrent(Real time) {
   **mIntfCurrent = **mCurrentRef;
 
-  SPDLOG_LOGGER_DEBUG(mSLog, "\nUpdate current: {:s}",
-                      Logger::matrixToString(**mIntfCurrent));
+  CPS_STEP_LOG_DEBUG(mSLog, "\nUpdate current: {:s}",
+                     Logger::matrixToString(**mIntfCurrent));
 }
 
 void EMT::Ph3::ControlledCurrentSource::mnaCompAddPreStepDependencies(
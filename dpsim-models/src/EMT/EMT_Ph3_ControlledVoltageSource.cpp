@@ -128,8 +128,8 @@ void EMT::Ph3::ControlledVoltageSource::mnaCompApplyRightSideVectorStamp(
 void EMT::Ph3::ControlledVoltageSource::updateVoltage(Real time) {
   **mIntfVoltage = **mVoltageRef;
 
-  SPDLOG_LOGGER_DEBUG(mSLog, "\nUpdate Voltage: {:s}",
-                      Logger::matrixToString(**mIntfVoltage));
+  CPS_STEP_LOG_DEBUG(mSLog, "\nUpdate Voltage: {:s}",
+                     Logger::matrixToString(**mIntfVoltage));
 }
 
 void EMT::Ph3::ControlledVoltageSource::mnaCompAddPreStepDependencies(
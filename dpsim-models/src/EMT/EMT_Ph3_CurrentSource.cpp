@@ -131,8 +131,8 @@ void EMT::Ph3::CurrentSource::updateCurrent(Real time) {
   } else {
     **mIntfCurrent = RMS_TO_PEAK * (**mCurrentRef).real();
   }
-  SPDLOG_LOGGER_DEBUG(mSLog, "\nUpdate current: {:s}",
-                      Logger::matrixToString(**mIntfCurrent));
+  CPS_STEP_LOG_DEBUG(mSLog, "\nUpdate current: {:s}",
+                     Logger::matrixToString(**mIntfCurrent));
 }
 
 void EMT::Ph3::CurrentSource::mnaCompAddPreStepDependencies(
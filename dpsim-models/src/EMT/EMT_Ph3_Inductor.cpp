@@ -117,10 +117,9 @@ void EMT::Ph3::Inductor::mnaCompApplyRightSideVectorStamp(Matrix &rightVector) {
     Math::setVectorElement(rightVector, matrixNodeIndex(1, 2),
                            -mEquivCurrent(2, 0));
   }
-  SPDLOG_LOGGER_DEBUG(
+  CPS_STEP_LOG_DEBUG(
       mSLog, "\nEquivalent Current (mnaCompApplyRightSideVectorStamp): {:s}",
       Logger::matrixToString(mEquivCurrent));
-  mSLog->flush();
 }
 
 void EMT::Ph3::Inductor::mnaCompAddPreStepDependencies(
@@ -175,15 +174,14 @@ void EMT::Ph3::Inductor::mnaCompUpdateVoltage(const Matrix &leftVector) {
         (**mIntfVoltage)(2, 0) -
         Math::realFromVectorElement(leftVector, matrixNodeIndex(0, 2));
   }
-  SPDLOG_LOGGER_DEBUG(mSLog, "\nUpdate Voltage: {:s}",
-                      Logger::matrixToString(**mIntfVoltage));
+  CPS_STEP_LOG_DEBUG(mSLog, "\nUpdate Voltage: {:s}",
+                     Logger::matrixToString(**mIntfVoltage));
 }
 
 void EMT::Ph3::Inductor::mnaCompUpdateCurrent(const Matrix &leftVector) {
   **mIntfCurrent = mEquivCond * **mIntfVoltage + mEquivCurrent;
-  SPDLOG_LOGGER_DEBUG(mSLog, "\nUpdate Current: {:s}",
-                      Logger::matrixToString(**mIntfCurrent));
-  mSLog->flush();
+  CPS_STEP_LOG_DEBUG(mSLog, "\nUpdate Current: {:s}",
+                     Logger::matrixToString(**mIntfCurrent));
 }
 
 // #### Tear Methods ####
@@ -109,8 +109,8 @@ void EMT::Ph3::NetworkInjection::initializeFromNodesAndTerminals(
 // #### MNA functions ####
 void EMT::Ph3::NetworkInjection::mnaParentApplyRightSideVectorStamp(
     Matrix &rightVector) {
-  SPDLOG_LOGGER_DEBUG(mSLog, "Right Side Vector: {:s}",
-                      Logger::matrixToString(rightVector));
+  CPS_STEP_LOG_DEBUG(mSLog, "Right Side Vector: {:s}",
+                     Logger::matrixToString(rightVector));
 }
 
 void EMT::Ph3::NetworkInjection::mnaParentAddPreStepDependencies(
@@ -118,18 +118,16 @@ void EMT::Ph3::Resistor::mnaCompUpdateVoltage(const Matrix &leftVector) {
         (**mIntfVoltage)(2, 0) -
         Math::realFromVectorElement(leftVector, matrixNodeIndex(0, 2));
   }
-  SPDLOG_LOGGER_DEBUG(mSLog, "\nVoltage: {:s}",
-                      Logger::matrixToString(**mIntfVoltage));
-  mSLog->flush();
+  CPS_STEP_LOG_DEBUG(mSLog, "\nVoltage: {:s}",
+                     Logger::matrixToString(**mIntfVoltage));
 }
 
 void EMT::Ph3::Resistor::mnaCompUpdateCurrent(const Matrix &leftVector) {
   Matrix resistanceInv = Matrix::Zero(3, 3);
   Math::invertMatrix(**mResistance, resistanceInv);
   **mIntfCurrent = resistanceInv * **mIntfVoltage;
-  SPDLOG_LOGGER_DEBUG(mSLog, "\nCurrent: {:s}",
-                      Logger::matrixToString(**mIntfCurrent));
-  mSLog->flush();
+  CPS_STEP_LOG_DEBUG(mSLog, "\nCurrent: {:s}",
+                     Logger::matrixToString(**mIntfCurrent));
 }
 
 // #### Tear Methods ####
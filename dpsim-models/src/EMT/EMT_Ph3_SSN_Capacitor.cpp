@@ -233,6 +233,6 @@ void EMT::Ph3::SSN::Capacitor::mnaCompUpdateCurrent(const Matrix &leftVector) {
   (**mIntfCurrent)(2, 0) = Math::realFromVectorElement(
       leftVector, mVirtualNodes[0]->matrixNodeIndex(PhaseType::C));
 
-  SPDLOG_LOGGER_DEBUG(mSLog, "\nCurrent: {:s}",
-                      Logger::matrixToString(**mIntfCurrent));
+  CPS_STEP_LOG_DEBUG(mSLog, "\nCurrent: {:s}",
+                     Logger::matrixToString(**mIntfCurrent));
 }
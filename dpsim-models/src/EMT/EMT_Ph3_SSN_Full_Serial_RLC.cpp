@@ -271,10 +271,9 @@ void EMT::Ph3::SSN::Full_Serial_RLC::mnaCompApplyRightSideVectorStamp(
     Math::setVectorElement(rightVector, matrixNodeIndex(1, 2),
                            -mYHistory(2, 0));
   }
-  SPDLOG_LOGGER_DEBUG(
+  CPS_STEP_LOG_DEBUG(
       mSLog, "\nHistory current term (mnaCompApplyRightSideVectorStamp): {:s}",
       Logger::matrixToString(mYHistory));
-  mSLog->flush();
 }
 
 void EMT::Ph3::SSN::Full_Serial_RLC::mnaCompAddPreStepDependencies(
@@ -333,18 +332,16 @@ void EMT::Ph3::SSN::Full_Serial_RLC::mnaCompUpdateVoltage(
         (**mIntfVoltage)(2, 0) -
         Math::realFromVectorElement(leftVector, matrixNodeIndex(0, 2));
   }
-  SPDLOG_LOGGER_DEBUG(mSLog, "\nUpdate Voltage: {:s}",
-                      Logger::matrixToString(**mIntfVoltage));
-  mSLog->flush();
+  CPS_STEP_LOG_DEBUG(mSLog, "\nUpdate Voltage: {:s}",
+                     Logger::matrixToString(**mIntfVoltage));
 }
 
 void EMT::Ph3::SSN::Full_Serial_RLC::mnaCompUpdateCurrent(
     const Matrix &leftVector) {
   **mIntfCurrent = mYHistory + mDufourWKN * **mIntfVoltage;
 
-  SPDLOG_LOGGER_DEBUG(mSLog, "\nUpdate Current: {:s}",
-                      Logger::matrixToString(**mIntfCurrent));
-  mSLog->flush();
+  CPS_STEP_LOG_DEBUG(mSLog, "\nUpdate Current: {:s}",
+                     Logger::matrixToString(**mIntfCurrent));
 }
 
 void EMT::Ph3::SSN::Full_Serial_RLC::setParameters(Matrix resistance,
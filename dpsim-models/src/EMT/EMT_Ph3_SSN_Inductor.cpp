@@ -123,10 +123,9 @@ void EMT::Ph3::SSN::Inductor::mnaCompApplyRightSideVectorStamp(
     Math::setVectorElement(rightVector, matrixNodeIndex(1, 2),
                            -mHistoricCurrent(2, 0));
   }
-  SPDLOG_LOGGER_DEBUG(
+  CPS_STEP_LOG_DEBUG(
       mSLog, "\nHistory current term (mnaCompApplyRightSideVectorStamp): {:s}",
       Logger::matrixToString(mHistoricCurrent));
-  mSLog->flush();
 }
 
 void EMT::Ph3::SSN::Inductor::mnaCompAddPreStepDependencies(
@@ -181,13 +180,12 @@ void EMT::Ph3::SSN::Inductor::mnaCompUpdateVoltage(const Matrix &leftVector) {
         (**mIntfVoltage)(2, 0) -
         Math::realFromVectorElement(leftVector, matrixNodeIndex(0, 2));
   }
-  SPDLOG_LOGGER_DEBUG(mSLog, "\nUpdate Voltage: {:s}",
-                      Logger::matrixToString(**mIntfVoltage));
+  CPS_STEP_LOG_DEBUG(mSLog, "\nUpdate Voltage: {:s}",
+                     Logger::matrixToString(**mIntfVoltage));
 }
 
 void EMT::Ph3::SSN::Inductor::mnaCompUpdateCurrent(const Matrix &leftVector) {
   **mIntfCurrent = mHistoricCurrent + mDufourWKN * **mIntfVoltage;
-  SPDLOG_LOGGER_DEBUG(mSLog, "\nUpdate Current: {:s}",
-                      Logger::matrixToString(**mIntfCurrent));
-  mSLog->flush();
+  CPS_STEP_LOG_DEBUG(mSLog, "\nUpdate Current: {:s}",
+                     Logger::matrixToString(**mIntfCurrent));
 }
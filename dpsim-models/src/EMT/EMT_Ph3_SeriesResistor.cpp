@@ -130,11 +130,11 @@ void EMT::Ph3::SeriesResistor::mnaCompUpdateVoltage(const Matrix &leftVector) {
         Math::realFromVectorElement(leftVector, matrixNodeIndex(0, 2));
   }
 
-  SPDLOG_LOGGER_DEBUG(mSLog, "Voltage A: {}", (**mIntfVoltage)(0, 0));
+  CPS_STEP_LOG_DEBUG(mSLog, "Voltage A: {}", (**mIntfVoltage)(0, 0));
 }
 
 void EMT::Ph3::SeriesResistor::mnaCompUpdateCurrent(const Matrix &leftVector) {
   **mIntfCurrent = **mIntfVoltage / **mResistance;
 
-  SPDLOG_LOGGER_DEBUG(mSLog, "Current A: {} < {}", (**mIntfCurrent)(0, 0));
+  CPS_STEP_LOG_DEBUG(mSLog, "Current A: {} < {}", (**mIntfCurrent)(0, 0));
 }
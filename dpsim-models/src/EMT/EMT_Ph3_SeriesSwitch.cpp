@@ -119,14 +119,14 @@ void EMT::Ph3::SeriesSwitch::mnaCompUpdateVoltage(const Matrix &leftVector) {
         Math::realFromVectorElement(leftVector, matrixNodeIndex(0, 2));
   }
 
-  SPDLOG_LOGGER_DEBUG(mSLog, "Voltage A: {}", (**mIntfVoltage)(0, 0));
+  CPS_STEP_LOG_DEBUG(mSLog, "Voltage A: {}", (**mIntfVoltage)(0, 0));
 }
 
 void EMT::Ph3::SeriesSwitch::mnaCompUpdateCurrent(const Matrix &leftVector) {
   Real impedance = (**mIsClosed) ? **mClosedResistance : **mOpenResistance;
   **mIntfCurrent = **mIntfVoltage / impedance;
 
-  SPDLOG_LOGGER_DEBUG(mSLog, "Current A: {}", (**mIntfCurrent)(0, 0));
+  CPS_STEP_LOG_DEBUG(mSLog, "Current A: {}", (**mIntfCurrent)(0, 0));
 }
 
 Bool EMT::Ph3::SeriesSwitch::hasParameterChanged() {
@@ -82,8 +82,8 @@ void EMT::Ph3::SynchronGeneratorDQODE::odePostStep() {
   mIdq0(2, 0) = mIsr(6, 0);
   **mIntfCurrent = mBase_I * dq0ToAbcTransform(mThetaMech, mIdq0);
 
-  SPDLOG_LOGGER_DEBUG(mSLog, "\nCurrent: \n{:s}",
-                      Logger::matrixCompToString(**mIntfCurrent));
+  CPS_STEP_LOG_DEBUG(mSLog, "\nCurrent: \n{:s}",
+                     Logger::matrixCompToString(**mIntfCurrent));
 }
 
 // ODE-Class simulation state-space
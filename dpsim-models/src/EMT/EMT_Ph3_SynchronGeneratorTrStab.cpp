@@ -311,7 +311,7 @@ void EMT::Ph3::SynchronGeneratorTrStab::mnaParentPostStep(
 
 void EMT::Ph3::SynchronGeneratorTrStab::mnaCompUpdateVoltage(
     const Matrix &leftVector) {
-  SPDLOG_LOGGER_DEBUG(mSLog, "Read voltage from {:d}", matrixNodeIndex(0));
+  CPS_STEP_LOG_DEBUG(mSLog, "Read voltage from {:d}", matrixNodeIndex(0));
   (**mIntfVoltage)(0, 0) =
       Math::realFromVectorElement(leftVector, matrixNodeIndex(0, 0));
   (**mIntfVoltage)(1, 0) =
@@ -322,7 +322,7 @@ void EMT::Ph3::SynchronGeneratorTrStab::mnaCompUpdateVoltage(
 
 void EMT::Ph3::SynchronGeneratorTrStab::mnaCompUpdateCurrent(
     const Matrix &leftVector) {
-  SPDLOG_LOGGER_DEBUG(mSLog, "Read current from {:d}", matrixNodeIndex(0));
+  CPS_STEP_LOG_DEBUG(mSLog, "Read current from {:d}", matrixNodeIndex(0));
 
   **mIntfCurrent = **mSubInductor->mIntfCurrent;
 }
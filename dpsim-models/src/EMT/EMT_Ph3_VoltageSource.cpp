@@ -201,8 +201,8 @@ void EMT::Ph3::VoltageSource::updateVoltage(Real time) {
   } else {
     **mIntfVoltage = RMS3PH_TO_PEAK1PH * (**mVoltageRef).real();
   }
-  SPDLOG_LOGGER_DEBUG(mSLog, "\nUpdate Voltage: {:s}",
-                      Logger::matrixToString(**mIntfVoltage));
+  CPS_STEP_LOG_DEBUG(mSLog, "\nUpdate Voltage: {:s}",
+                     Logger::matrixToString(**mIntfVoltage));
 }
 
 void EMT::Ph3::VoltageSource::mnaCompAddPreStepDependencies(
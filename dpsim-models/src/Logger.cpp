@@ -8,6 +8,7 @@
 
 #include <iomanip>
 #include <memory>
+#include <mutex>
 
 #include <spdlog/sinks/null_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
@@ -138,6 +139,11 @@ String Logger::getCSVLineFromData(Real time, const MatrixComp &data) {
 
 Logger::Log Logger::get(const std::string &name, Level filelevel,
                         Level clilevel) {
+  // Simulations may run concurrently in several threads and register loggers
+  // of the same name in the spdlog registry
+  static std::mutex mutex;
+  std::lock_guard<std::mutex> lock(mutex);
+
   Logger::Log logger = spdlog::get(name);
 
   if (!logger) {
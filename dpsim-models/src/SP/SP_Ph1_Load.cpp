@@ -85,6 +85,19 @@ void SP::Ph1::Load::modifyPowerFlowBusType(PowerflowBusType powerflowBusType) {
 };
 
 void SP::Ph1::Load::updatePQ(Real time) {
+  if (mLoadProfile.hasGrid()) {
+    if (mLoadProfile.weightingFactorGrid.empty()) {
+      PQData pq = mLoadProfile.pqAt(time);
+      **mActivePower = pq.p;
+      **mReactivePower = pq.q;
+    } else {
+      Real wf = mLoadProfile.weightingFactorAt(time);
+      **mActivePower = this->attributeTyped<Real>("P_nom")->get() * wf;
+      **mReactivePower = this->attributeTyped<Real>("Q_nom")->get() * wf;
+    }
+    return;
+  }
+
   if (mLoadProfile.weightingFactors.empty()) {
     **mActivePower = mLoadProfile.pqData.find(time)->second.p;
     **mReactivePower = mLoadProfile.pqData.find(time)->second.q;
@@ -156,8 +156,8 @@ void SP::Ph1::NetworkInjection::initializeFromNodesAndTerminals(
 // #### MNA functions ####
 void SP::Ph1::NetworkInjection::mnaParentApplyRightSideVectorStamp(
     Matrix &rightVector) {
-  SPDLOG_LOGGER_DEBUG(mSLog, "Right Side Vector: {:s}",
-                      Logger::matrixToString(rightVector));
+  CPS_STEP_LOG_DEBUG(mSLog, "Right Side Vector: {:s}",
+                     Logger::matrixToString(rightVector));
 }
 
 void SP::Ph1::NetworkInjection::mnaParentAddPreStepDependencies(
@@ -141,16 +141,16 @@ void SP::Ph1::Resistor::mnaCompUpdateVoltage(const Matrix &leftVector) {
           Math::complexFromVectorElement(leftVector, matrixNodeIndex(0),
                                          mNumFreqs, freq);
 
-    SPDLOG_LOGGER_DEBUG(mSLog, "Voltage {:s}",
-                        Logger::phasorToString((**mIntfVoltage)(0, freq)));
+    CPS_STEP_LOG_DEBUG(mSLog, "Voltage {:s}",
+                       Logger::phasorToString((**mIntfVoltage)(0, freq)));
   }
 }
 
 void SP::Ph1::Resistor::mnaCompUpdateCurrent(const Matrix &leftVector) {
   for (UInt freq = 0; freq < mNumFreqs; freq++) {
     (**mIntfCurrent)(0, freq) = (**mIntfVoltage)(0, freq) / **mResistance;
-    SPDLOG_LOGGER_DEBUG(mSLog, "Current {:s}",
-                        Logger::phasorToString((**mIntfCurrent)(0, freq)));
+    CPS_STEP_LOG_DEBUG(mSLog, "Current {:s}",
+                       Logger::phasorToString((**mIntfCurrent)(0, freq)));
   }
 }
 
@@ -280,8 +280,8 @@ void SP::Ph1::SynchronGeneratorTrStab::step(Real time) {
   mStates << Math::abs(**mEp), Math::phaseDeg(**mEp), **mElecActivePower,
       **mMechPower, **mDelta_p, **mOmMech, dOmMech, dDelta_p,
       (**mIntfVoltage)(0, 0).real(), (**mIntfVoltage)(0, 0).imag();
-  SPDLOG_LOGGER_DEBUG(mSLog, "\nStates, time {:f}: \n{:s}", time,
-                      Logger::matrixToString(mStates));
+  CPS_STEP_LOG_DEBUG(mSLog, "\nStates, time {:f}: \n{:s}", time,
+                     Logger::matrixToString(mStates));
 }
 
 void SP::Ph1::SynchronGeneratorTrStab::mnaParentInitialize(
@@ -331,14 +331,14 @@ void SP::Ph1::SynchronGeneratorTrStab::mnaParentPostStep(
 
 void SP::Ph1::SynchronGeneratorTrStab::mnaCompUpdateVoltage(
     const Matrix &leftVector) {
-  SPDLOG_LOGGER_DEBUG(mSLog, "Read voltage from {:d}", matrixNodeIndex(0));
+  CPS_STEP_LOG_DEBUG(mSLog, "Read voltage from {:d}", matrixNodeIndex(0));
   (**mIntfVoltage)(0, 0) =
       Math::complexFromVectorElement(leftVector, matrixNodeIndex(0));
 }
 
 void SP::Ph1::SynchronGeneratorTrStab::mnaCompUpdateCurrent(
     const Matrix &leftVector) {
-  SPDLOG_LOGGER_DEBUG(mSLog, "Read current from {:d}", matrixNodeIndex(0));
+  CPS_STEP_LOG_DEBUG(mSLog, "Read current from {:d}", matrixNodeIndex(0));
   //Current flowing out of component
   **mIntfCurrent = mSubInductor->mIntfCurrent->get();
 }
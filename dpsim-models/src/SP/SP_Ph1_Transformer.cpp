@@ -433,8 +433,8 @@ void SP::Ph1::Transformer::mnaParentPostStep(
 
 void SP::Ph1::Transformer::mnaCompUpdateCurrent(const Matrix &leftVector) {
   (**mIntfCurrent)(0, 0) = mSubInductor->intfCurrent()(0, 0);
-  SPDLOG_LOGGER_DEBUG(mSLog, "Current {:s}",
-                      Logger::phasorToString((**mIntfCurrent)(0, 0)));
+  CPS_STEP_LOG_DEBUG(mSLog, "Current {:s}",
+                     Logger::phasorToString((**mIntfCurrent)(0, 0)));
 }
 
 void SP::Ph1::Transformer::mnaCompUpdateVoltage(const Matrix &leftVector) {
@@ -445,6 +445,6 @@ void SP::Ph1::Transformer::mnaCompUpdateVoltage(const Matrix &leftVector) {
   (**mIntfVoltage)(0, 0) = (**mIntfVoltage)(0, 0) -
                            Math::complexFromVectorElement(
                                leftVector, mVirtualNodes[0]->matrixNodeIndex());
-  SPDLOG_LOGGER_DEBUG(mSLog, "Voltage {:s}",
-                      Logger::phasorToString((**mIntfVoltage)(0, 0)));
+  CPS_STEP_LOG_DEBUG(mSLog, "Voltage {:s}",
+                     Logger::phasorToString((**mIntfVoltage)(0, 0)));
 }
@@ -169,9 +169,9 @@ void SP::Ph1::VoltageSource::mnaCompApplyRightSideVectorStamp(
   // TODO: Is this correct with two nodes not gnd?
   Math::setVectorElement(rightVector, mVirtualNodes[0]->matrixNodeIndex(),
                          (**mIntfVoltage)(0, 0), mNumFreqs);
-  SPDLOG_LOGGER_DEBUG(mSLog, "Add {:s} to source vector at {:d}",
-                      Logger::complexToString((**mIntfVoltage)(0, 0)),
-                      mVirtualNodes[0]->matrixNodeIndex());
+  CPS_STEP_LOG_DEBUG(mSLog, "Add {:s} to source vector at {:d}",
+                     Logger::complexToString((**mIntfVoltage)(0, 0)),
+                     mVirtualNodes[0]->matrixNodeIndex());
 }
 
 void SP::Ph1::VoltageSource::updateVoltage(Real time) {
@@ -182,8 +182,8 @@ void SP::Ph1::VoltageSource::updateVoltage(Real time) {
     (**mIntfVoltage)(0, 0) = **mVoltageRef;
   }
 
-  SPDLOG_LOGGER_DEBUG(mSLog, "Update Voltage {:s}",
-                      Logger::phasorToString((**mIntfVoltage)(0, 0)));
+  CPS_STEP_LOG_DEBUG(mSLog, "Update Voltage {:s}",
+                     Logger::phasorToString((**mIntfVoltage)(0, 0)));
 }
 
 void SP::Ph1::VoltageSource::mnaCompPreStep(Real time, Int timeStepCount) {
@@ -113,6 +113,14 @@ void DecouplingLine::initialize(Real omega, Real timeStep) {
   mVolt2.resize(mBufSize, volt2);
   mCur1.resize(mBufSize, cur1);
   mCur2.resize(mBufSize, cur2);
+
+  Real impedance = mSurgeImpedance + mResistance / 4;
+  mSrcAdmittance = 1. / impedance;
+  mRemoteGain = -mSurgeImpedance / (impedance * impedance);
+  mLocalGain = -mResistance / 4 / (impedance * impedance);
+  mHistoryImpedance = mSurgeImpedance - mResistance / 4;
+  mDelayShift =
+      Complex(cos(-2. * PI * 50 * mDelay), sin(-2. * PI * 50 * mDelay));
 }
 
 Complex DecouplingLine::interpolate(std::vector<Complex> &data) {
@@ -130,24 +138,14 @@ void DecouplingLine::step(Real time, Int timeStepCount) {
 
   if (timeStepCount == 0) {
     // bit of a hack for proper initialization
-    **mSrcCur1Ref = cur1 - volt1 / (mSurgeImpedance + mResistance / 4);
-    **mSrcCur2Ref = cur2 - volt2 / (mSurgeImpedance + mResistance / 4);
+    **mSrcCur1Ref = cur1 - volt1 * mSrcAdmittance;
+    **mSrcCur2Ref = cur2 - volt2 * mSrcAdmittance;
   } else {
     // Update currents
-    Real denom = (mSurgeImpedance + mResistance / 4) *
-                 (mSurgeImpedance + mResistance / 4);
-    **mSrcCur1Ref = -mSurgeImpedance / denom *
-                        (volt2 + (mSurgeImpedance - mResistance / 4) * cur2) -
-                    mResistance / 4 / denom *
-                        (volt1 + (mSurgeImpedance - mResistance / 4) * cur1);
-    **mSrcCur2Ref = -mSurgeImpedance / denom *
-                        (volt1 + (mSurgeImpedance - mResistance / 4) * cur1) -
-                    mResistance / 4 / denom *
-                        (volt2 + (mSurgeImpedance - mResistance / 4) * cur2);
-    **mSrcCur1Ref = **mSrcCur1Ref * Complex(cos(-2. * PI * 50 * mDelay),
-                                            sin(-2. * PI * 50 * mDelay));
-    **mSrcCur2Ref = **mSrcCur2Ref * Complex(cos(-2. * PI * 50 * mDelay),
-                                            sin(-2. * PI * 50 * mDelay));
+    Complex hist1 = volt1 + mHistoryImpedance * cur1;
+    Complex hist2 = volt2 + mHistoryImpedance * cur2;
+    **mSrcCur1Ref = (mRemoteGain * hist2 + mLocalGain * hist1) * mDelayShift;
+    **mSrcCur2Ref = (mRemoteGain * hist1 + mLocalGain * hist2) * mDelayShift;
   }
   mSrcCur1->set(**mSrcCur1Ref);
   mSrcCur2->set(**mSrcCur2Ref);
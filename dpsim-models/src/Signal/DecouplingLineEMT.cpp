@@ -77,6 +77,12 @@ void DecouplingLineEMT::initialize(Real omega, Real timeStep) {
   mVolt2.resize(mBufSize, volt2.real());
   mCur1.resize(mBufSize, cur1.real());
   mCur2.resize(mBufSize, cur2.real());
+
+  Real impedance = mSurgeImpedance + mResistance / 4;
+  mSrcAdmittance = 1. / impedance;
+  mRemoteGain = -mSurgeImpedance / (impedance * impedance);
+  mLocalGain = -mResistance / 4 / (impedance * impedance);
+  mHistoryImpedance = mSurgeImpedance - mResistance / 4;
 }
 
 Real DecouplingLineEMT::interpolate(std::vector<Real> &data) {
@@ -91,23 +97,17 @@ void DecouplingLineEMT::step(Real time, Int timeStepCount) {
   Real volt2 = interpolate(mVolt2);
   Real cur1 = interpolate(mCur1);
   Real cur2 = interpolate(mCur2);
-  Real denom =
-      (mSurgeImpedance + mResistance / 4) * (mSurgeImpedance + mResistance / 4);
 
   if (timeStepCount == 0) {
     // initialization
-    **mSrcCur1Ref = cur1 - volt1 / (mSurgeImpedance + mResistance / 4);
-    **mSrcCur2Ref = cur2 - volt2 / (mSurgeImpedance + mResistance / 4);
+    **mSrcCur1Ref = cur1 - volt1 * mSrcAdmittance;
+    **mSrcCur2Ref = cur2 - volt2 * mSrcAdmittance;
   } else {
     // Update currents
-    **mSrcCur1Ref = -mSurgeImpedance / denom *
-                        (volt2 + (mSurgeImpedance - mResistance / 4) * cur2) -
-                    mResistance / 4 / denom *
-                        (volt1 + (mSurgeImpedance - mResistance / 4) * cur1);
-    **mSrcCur2Ref = -mSurgeImpedance / denom *
-                        (volt1 + (mSurgeImpedance - mResistance / 4) * cur1) -
-                    mResistance / 4 / denom *
-                        (volt2 + (mSurgeImpedance - mResistance / 4) * cur2);
+    Real hist1 = volt1 + mHistoryImpedance * cur1;
+    Real hist2 = volt2 + mHistoryImpedance * cur2;
+    **mSrcCur1Ref = mRemoteGain * hist2 + mLocalGain * hist1;
+    **mSrcCur2Ref = mRemoteGain * hist1 + mLocalGain * hist2;
   }
   mSrcCur1->set(**mSrcCur1Ref);
   mSrcCur2->set(**mSrcCur2Ref);
@@ -86,46 +86,48 @@ void DecouplingLineEMT_Ph3::initialize(Real omega, Real timeStep) {
   SPDLOG_LOGGER_INFO(mSLog, "initial currents: i_km {} i_mk {}", cur1, cur2);
 
   // Resize ring buffers and initialize
-  mVolt1 = volt1.real().transpose().replicate(mBufSize, 1);
-  mVolt2 = volt2.real().transpose().replicate(mBufSize, 1);
-  mCur1 = cur1.real().transpose().replicate(mBufSize, 1);
-  mCur2 = cur2.real().transpose().replicate(mBufSize, 1);
+  mVolt1 = volt1.real().replicate(1, mBufSize);
+  mVolt2 = volt2.real().replicate(1, mBufSize);
+  mCur1 = cur1.real().replicate(1, mBufSize);
+  mCur2 = cur2.real().replicate(1, mBufSize);
+
+  MatrixFixedSize<3, 3> impedance = mSurgeImpedance + mResistance / 4;
+  MatrixFixedSize<3, 3> denomInv = (impedance * impedance).inverse();
+  mSrcAdmittance = impedance.inverse();
+  mRemoteGain = -mSurgeImpedance * denomInv;
+  mLocalGain = -mResistance / 4 * denomInv;
+  mHistoryImpedance = mSurgeImpedance - mResistance / 4;
 }
 
-Matrix DecouplingLineEMT_Ph3::interpolate(Matrix &data) {
+void DecouplingLineEMT_Ph3::interpolate(
+    const MatrixFixedSize<3, Eigen::Dynamic> &data,
+    MatrixFixedSize<3, 1> &result) const {
   // linear interpolation of the nearest values
-  Matrix c1 = data.row(mBufIdx);
-  Matrix c2 = mBufIdx == mBufSize - 1 ? data.row(0) : data.row(mBufIdx + 1);
-  return (mAlpha * c1 + (1 - mAlpha) * c2).transpose();
+  UInt next = mBufIdx == mBufSize - 1 ? 0 : mBufIdx + 1;
+  result = mAlpha * data.col(mBufIdx) + (1 - mAlpha) * data.col(next);
 }
 
 void DecouplingLineEMT_Ph3::step(Real time, Int timeStepCount) {
-  Matrix volt1 = interpolate(mVolt1);
-  Matrix volt2 = interpolate(mVolt2);
-  Matrix cur1 = interpolate(mCur1);
-  Matrix cur2 = interpolate(mCur2);
-  Matrix denom = (mSurgeImpedance + (mResistance / 4)) *
-                 (mSurgeImpedance + (mResistance / 4));
+  MatrixFixedSize<3, 1> volt1, volt2, cur1, cur2;
+  interpolate(mVolt1, volt1);
+  interpolate(mVolt2, volt2);
+  interpolate(mCur1, cur1);
+  interpolate(mCur2, cur2);
 
   if (timeStepCount == 0) {
     // initialization
-    **mSrcCur1Ref =
-        cur1 - (mSurgeImpedance + mResistance / 4).inverse() * volt1;
-    **mSrcCur2Ref =
-        cur2 - (mSurgeImpedance + mResistance / 4).inverse() * volt2;
+    **mSrcCur1Ref = cur1 - mSrcAdmittance * volt1;
+    **mSrcCur2Ref = cur2 - mSrcAdmittance * volt2;
   } else {
     // Update currents
-    **mSrcCur1Ref = -mSurgeImpedance * denom.inverse() *
-                        (volt2 + (mSurgeImpedance - mResistance / 4) * cur2) -
-                    mResistance / 4 * denom.inverse() *
-                        (volt1 + (mSurgeImpedance - mResistance / 4) * cur1);
-    **mSrcCur2Ref = -mSurgeImpedance * denom.inverse() *
-                        (volt1 + (mSurgeImpedance - mResistance / 4) * cur1) -
-                    mResistance / 4 * denom.inverse() *
-                        (volt2 + (mSurgeImpedance - mResistance / 4) * cur2);
+    MatrixFixedSize<3, 1> hist1 = volt1 + mHistoryImpedance * cur1;
+    MatrixFixedSize<3, 1> hist2 = volt2 + mHistoryImpedance * cur2;
+    **mSrcCur1Ref = mRemoteGain * hist2 + mLocalGain * hist1;
+    **mSrcCur2Ref = mRemoteGain * hist1 + mLocalGain * hist2;
   }
-  mSrcCur1->set(**mSrcCur1Ref);
-  mSrcCur2->set(**mSrcCur2Ref);
+  // Assign in place, set() would copy the matrix
+  **mSrcCur1 = **mSrcCur1Ref;
+  **mSrcCur2 = **mSrcCur2Ref;
 }
 
 void DecouplingLineEMT_Ph3::PreStep::execute(Real time, Int timeStepCount) {
@@ -134,12 +136,10 @@ void DecouplingLineEMT_Ph3::PreStep::execute(Real time, Int timeStepCount) {
 
 void DecouplingLineEMT_Ph3::postStep() {
   // Update ringbuffers with new values
-  mVolt1.row(mBufIdx) = -mRes1->intfVoltage().transpose();
-  mVolt2.row(mBufIdx) = -mRes2->intfVoltage().transpose();
-  mCur1.row(mBufIdx) =
-      -mRes1->intfCurrent().transpose() + mSrcCur1->get().real().transpose();
-  mCur2.row(mBufIdx) =
-      -mRes2->intfCurrent().transpose() + mSrcCur2->get().real().transpose();
+  mVolt1.col(mBufIdx) = -mRes1->intfVoltage();
+  mVolt2.col(mBufIdx) = -mRes2->intfVoltage();
+  mCur1.col(mBufIdx) = mSrcCur1->get() - mRes1->intfCurrent();
+  mCur2.col(mBufIdx) = mSrcCur2->get() - mRes2->intfCurrent();
 
   mBufIdx++;
   if (mBufIdx == mBufSize)
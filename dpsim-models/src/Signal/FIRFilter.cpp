@@ -39,7 +39,7 @@ void FIRFilter::step(Real time) {
 
   incrementIndex();
   **mOutput = output;
-  SPDLOG_LOGGER_DEBUG(mSLog, "Set output to {}", output);
+  CPS_STEP_LOG_DEBUG(mSLog, "Set output to {}", output);
 }
 
 void FIRFilter::Step::execute(Real time, Int timeStepCount) {
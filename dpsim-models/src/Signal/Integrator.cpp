@@ -68,8 +68,8 @@ void Integrator::signalAddStepDependencies(
 void Integrator::signalStep(Real time, Int timeStepCount) {
   **mInputCurr = **mInputRef;
 
-  SPDLOG_LOGGER_INFO(mSLog, "Time {}:", time);
-  SPDLOG_LOGGER_INFO(
+  CPS_STEP_LOG_INFO(mSLog, "Time {}:", time);
+  CPS_STEP_LOG_INFO(
       mSLog, "Input values: inputCurr = {}, inputPrev = {}, statePrev = {}",
       **mInputCurr, **mInputPrev, **mStatePrev);
 
@@ -77,8 +77,8 @@ void Integrator::signalStep(Real time, Int timeStepCount) {
                  mTimeStep / 2.0 * **mInputPrev;
   **mOutputCurr = **mStateCurr;
 
-  SPDLOG_LOGGER_INFO(mSLog, "State values: stateCurr = {}", **mStateCurr);
-  SPDLOG_LOGGER_INFO(mSLog, "Output values: outputCurr = {}:", **mOutputCurr);
+  CPS_STEP_LOG_INFO(mSLog, "State values: stateCurr = {}", **mStateCurr);
+  CPS_STEP_LOG_INFO(mSLog, "Output values: outputCurr = {}:", **mOutputCurr);
 }
 
 Task::List Integrator::getTasks() {
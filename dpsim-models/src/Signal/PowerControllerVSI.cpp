@@ -168,7 +168,7 @@ void PowerControllerVSI::signalStep(Real time, Int timeStepCount) {
 
   // get current inputs
   **mInputCurr << mPref, mQref, **mVc_d, **mVc_q, **mIrc_d, **mIrc_q;
-  SPDLOG_LOGGER_DEBUG(
+  CPS_STEP_LOG_DEBUG(
       mSLog,
       "Time {}\n: inputCurr = \n{}\n , inputPrev = \n{}\n , statePrev = \n{}",
       time, **mInputCurr, **mInputPrev, **mStatePrev);
@@ -176,11 +176,11 @@ void PowerControllerVSI::signalStep(Real time, Int timeStepCount) {
   // calculate new states
   **mStateCurr = Math::StateSpaceTrapezoidal(**mStatePrev, mA, mB, mTimeStep,
                                              **mInputCurr, **mInputPrev);
-  SPDLOG_LOGGER_DEBUG(mSLog, "stateCurr = \n {}", **mStateCurr);
+  CPS_STEP_LOG_DEBUG(mSLog, "stateCurr = \n {}", **mStateCurr);
 
   // calculate new outputs
   **mOutputCurr = mC * **mStateCurr + mD * **mInputCurr;
-  SPDLOG_LOGGER_DEBUG(mSLog, "Output values: outputCurr = \n{}", **mOutputCurr);
+  CPS_STEP_LOG_DEBUG(mSLog, "Output values: outputCurr = \n{}", **mOutputCurr);
 }
 
 void PowerControllerVSI::updateBMatrixStateSpaceModel() {
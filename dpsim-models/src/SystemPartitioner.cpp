@@ -0,0 +1,370 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <numeric>
+#include <queue>
+
+#include <dpsim-models/DP/DP_Ph1_PiLine.h>
+#include <dpsim-models/EMT/EMT_Ph3_PiLine.h>
+#include <dpsim-models/Signal/DecouplingLine.h>
+#include <dpsim-models/Signal/DecouplingLineEMT_Ph3.h>
+#include <dpsim-models/Solver/MNATearInterface.h>
+#include <dpsim-models/SystemPartitioner.h>
+
+using namespace CPS;
+
+namespace {
+/// Value of a real or matrix attribute, the first entry for matrices and
+/// zero if the component has no such attribute
+Real realAttribute(const IdentifiedObject::Ptr &comp, const String &name) {
+  auto &attributes = comp->attributes();
+  auto it = attributes.find(name);
+  if (it == attributes.end())
+    return 0;
+  if (auto real =
+          std::dynamic_pointer_cast<Attribute<Real>>(it->second.getPtr()))
+    return real->get();
+  if (auto matrix =
+          std::dynamic_pointer_cast<Attribute<Matrix>>(it->second.getPtr()))
+    return matrix->get().size() > 0 ? matrix->get()(0, 0) : 0;
+  return 0;
+}
+} // namespace
+
+SystemPartitioner::SystemPartitioner(SystemTopology &system, Mode mode,
+                                     Real timeStep, Logger::Level logLevel)
+    : mSystem(system), mMode(mode), mTimeStep(timeStep),
+      mSLog(Logger::get("SystemPartitioner", logLevel)) {}
+
+Real SystemPartitioner::seriesImpedance(const IdentifiedObject::Ptr &comp) {
+  Real omega = 2 * PI * mSystem.mSystemFrequency;
+  Real resistance = realAttribute(comp, "R_series") + realAttribute(comp, "R");
+  Real inductance = realAttribute(comp, "L_series") + realAttribute(comp, "L");
+  return std::abs(Complex(resistance, omega * inductance));
+}
+
+Real SystemPartitioner::cutCost(const IdentifiedObject::Ptr &comp,
+                                const TopologicalNode::List &nodes,
+                                Real minImpedance) {
+  if (nodes.size() != 2)
+    return 0;
+
+  if (mMode == Mode::Tearing) {
+    if (!std::dynamic_pointer_cast<MNATearInterface>(comp))
+      return 0;
+    Real impedance = seriesImpedance(comp);
+    if (impedance <= 0)
+      return 0;
+    // Between 1 and 2, so the number of cut branches dominates
+    return 1 + minImpedance / impedance;
+  }
+
+  if (!std::dynamic_pointer_cast<DP::Ph1::PiLine>(comp) &&
+      !std::dynamic_pointer_cast<EMT::Ph3::PiLine>(comp))
+    return 0;
+  Real delay = std::sqrt(realAttribute(comp, "L_series") *
+                         realAttribute(comp, "C_parallel"));
+  return (mTimeStep > 0 && delay >= mTimeStep) ? 1 : 0;
+}
+
+void SystemPartitioner::buildGraph() {
+  UInt numNodes = mSystem.mNodes.size();
+  std::map<TopologicalNode::Ptr, UInt> nodeIndex;
+  for (UInt i = 0; i < numNodes; ++i) {
+    if (!mSystem.mNodes[i]->isGround())
+      nodeIndex[mSystem.mNodes[i]] = i;
+  }
+
+  // Non-ground nodes of every power component
+  std::vector<std::pair<IdentifiedObject::Ptr, std::vector<UInt>>> branches;
+  std::vector<TopologicalNode::List> branchNodes;
+  Real minImpedance = std::numeric_limits<Real>::max();
+  for (auto comp : mSystem.mComponents) {
+    auto pComp = std::dynamic_pointer_cast<TopologicalPowerComp>(comp);
+    if (!pComp)
+      continue;
+    std::vector<UInt> indices;
+    TopologicalNode::List nodes;
+    for (auto node : pComp->topologicalNodes()) {
+      auto it = nodeIndex.find(node);
+      if (it == nodeIndex.end())
+        continue;
+      indices.push_back(it->second);
+      nodes.push_back(node);
+    }
+    if (indices.size() < 2)
+      continue;
+    if (mMode == Mode::Tearing &&
+        std::dynamic_pointer_cast<MNATearInterface>(comp)) {
+      Real impedance = seriesImpedance(comp);
+      if (impedance > 0)
+        minImpedance = std::min(minImpedance, impedance);
+    }
+    branches.emplace_back(comp, indices);
+    branchNodes.push_back(nodes);
+  }
+
+  // Join the nodes of all branches that must not be cut
+  std::vector<UInt> parent(numNodes);
+  std::iota(parent.begin(), parent.end(), 0);
+  auto find = [&parent](UInt i) {
+    while (parent[i] != i)
+      i = parent[i] = parent[parent[i]];
+    return i;
+  };
+
+  std::vector<std::pair<UInt, Real>> candidates;
+  for (UInt b = 0; b < branches.size(); ++b) {
+    Real cost = cutCost(branches[b].first, branchNodes[b], minImpedance);
+    if (cost > 0) {
+      candidates.emplace_back(b, cost);
+      continue;
+    }
+    auto &indices = branches[b].second;
+    for (UInt i = 1; i < indices.size(); ++i)
+      parent[find(indices[i])] = find(indices[0]);
+  }
+
+  mGroupOfNode.assign(numNodes, -1);
+  mGroupWeights.clear();
+  std::map<UInt, UInt> groupOfRoot;
+  for (auto &entry : nodeIndex) {
+    UInt root = find(entry.second);
+    auto it = groupOfRoot.find(root);
+    if (it == groupOfRoot.end()) {
+      it = groupOfRoot.emplace(root, mGroupWeights.size()).first;
+      mGroupWeights.push_back(0);
+    }
+    mGroupOfNode[entry.second] = it->second;
+    ++mGroupWeights[it->second];
+  }
+
+  // Parallel candidates between the same groups are merged into one edge
+  std::map<std::pair<UInt, UInt>, Real> edges;
+  mCandidates.clear();
+  for (auto &candidate : candidates) {
+    auto &branch = branches[candidate.first];
+    UInt a = mGroupOfNode[branch.second[0]];
+    UInt b = mGroupOfNode[branch.second[1]];
+    mCandidates.push_back({branch.first, {a, b}});
+    if (a != b)
+      edges[{std::min(a, b), std::max(a, b)}] += candidate.second;
+  }
+
+  mAdjacency.assign(mGroupWeights.size(), {});
+  for (auto &edge : edges) {
+    mAdjacency[edge.first.first].push_back({edge.first.second, edge.second});
+    mAdjacency[edge.first.second].push_back({edge.first.first, edge.second});
+  }
+
+  SPDLOG_LOGGER_INFO(mSLog, "{} nodes in {} groups, {} candidate branches",
+                     nodeIndex.size(), mGroupWeights.size(),
+                     mCandidates.size());
+}
+
+void SystemPartitioner::bisect(const std::vector<UInt> &set, UInt numParts,
+                               UInt firstPart, std::vector<Int> &part) {
+  if (numParts == 1) {
+    for (auto g : set)
+      part[g] = firstPart;
+    return;
+  }
+  if (set.size() <= numParts) {
+    for (UInt i = 0; i < set.size(); ++i)
+      part[set[i]] = firstPart + i;
+    return;
+  }
+
+  UInt numGroups = mGroupWeights.size();
+  std::vector<Bool> inSet(numGroups, false);
+  UInt totalWeight = 0;
+  UInt maxWeight = 0;
+  for (auto g : set) {
+    inSet[g] = true;
+    totalWeight += mGroupWeights[g];
+    maxWeight = std::max(maxWeight, mGroupWeights[g]);
+  }
+  UInt leftParts = numParts / 2;
+  Real target = static_cast<Real>(totalWeight) * leftParts / numParts;
+
+  // Start from a group far away from the first one
+  UInt start = set[0];
+  {
+    std::vector<Bool> visited(numGroups, false);
+    std::queue<UInt> queue;
+    queue.push(start);
+    visited[start] = true;
+    while (!queue.empty()) {
+      start = queue.front();
+      queue.pop();
+      for (auto &edge : mAdjacency[start]) {
+        if (inSet[edge.to] && !visited[edge.to]) {
+          visited[edge.to] = true;
+          queue.push(edge.to);
+        }
+      }
+    }
+  }
+
+  // Greedily grow the left side by the group most connected to it
+  std::vector<Bool> left(numGroups, false);
+  std::vector<Real> connection(numGroups, 0);
+  std::priority_queue<std::pair<Real, UInt>> frontier;
+  Real leftWeight = 0;
+  UInt nextUnvisited = 0;
+  frontier.push({0, start});
+
+  while (leftWeight < target) {
+    UInt g;
+    if (frontier.empty()) {
+      // The set is not connected, continue with another component
+      while (left[set[nextUnvisited]])
+        ++nextUnvisited;
+      g = set[nextUnvisited];
+    } else {
+      auto top = frontier.top();
+      frontier.pop();
+      g = top.second;
+      if (left[g] || top.first != connection[g])
+        continue;
+    }
+    Real weight = mGroupWeights[g];
+    if (leftWeight > 0 && leftWeight + weight - target > target - leftWeight)
+      break;
+
+    left[g] = true;
+    leftWeight += weight;
+    for (auto &edge : mAdjacency[g]) {
+      if (inSet[edge.to] && !left[edge.to]) {
+        connection[edge.to] += edge.cost;
+        frontier.push({connection[edge.to], edge.to});
+      }
+    }
+  }
+
+  // Move groups to the other side as long as this reduces the cut and keeps
+  // the balance
+  Real allowed = std::max(mImbalance * target, static_cast<Real>(maxWeight));
+  for (UInt pass = 0; pass < 10; ++pass) {
+    Bool improved = false;
+    for (auto g : set) {
+      Real internal = 0, external = 0;
+      for (auto &edge : mAdjacency[g]) {
+        if (!inSet[edge.to])
+          continue;
+        if (left[edge.to] == left[g])
+          internal += edge.cost;
+        else
+          external += edge.cost;
+      }
+      if (external - internal <= 0)
+        continue;
+
+      Real weight = mGroupWeights[g];
+      Real newLeftWeight = left[g] ? leftWeight - weight : leftWeight + weight;
+      if (std::abs(newLeftWeight - target) > allowed || newLeftWeight <= 0 ||
+          newLeftWeight >= totalWeight)
+        continue;
+      left[g] = !left[g];
+      leftWeight = newLeftWeight;
+      improved = true;
+    }
+    if (!improved)
+      break;
+  }
+
+  std::vector<UInt> leftSet, rightSet;
+  for (auto g : set)
+    (left[g] ? leftSet : rightSet).push_back(g);
+  bisect(leftSet, leftParts, firstPart, part);
+  bisect(rightSet, numParts - leftParts, firstPart + leftParts, part);
+}
+
+SystemPartitioner::Partition SystemPartitioner::partition(UInt numSubnets) {
+  if (numSubnets == 0)
+    throw std::invalid_argument("Number of subnets must be positive");
+
+  buildGraph();
+  if (mGroupWeights.size() < numSubnets)
+    throw std::invalid_argument(
+        "System can be split into at most " +
+        std::to_string(mGroupWeights.size()) + " subnets at candidate "
+        "branches");
+
+  std::vector<UInt> groups(mGroupWeights.size());
+  std::iota(groups.begin(), groups.end(), 0);
+  std::vector<Int> part(groups.size(), -1);
+  bisect(groups, numSubnets, 0, part);
+
+  Partition partition;
+  partition.subnetSizes.assign(numSubnets, 0);
+  partition.nodeSubnet.assign(mSystem.mNodes.size(), -1);
+  for (UInt i = 0; i < mSystem.mNodes.size(); ++i) {
+    if (mGroupOfNode[i] < 0)
+      continue;
+    partition.nodeSubnet[i] = part[mGroupOfNode[i]];
+    ++partition.subnetSizes[partition.nodeSubnet[i]];
+  }
+  for (auto &candidate : mCandidates) {
+    if (part[candidate.second.first] != part[candidate.second.second])
+      partition.cut.push_back(candidate.first);
+  }
+
+  std::stringstream sizes;
+  for (auto size : partition.subnetSizes)
+    sizes << size << " ";
+  SPDLOG_LOGGER_INFO(mSLog, "Split into {} subnets with {}nodes, {} cut "
+                     "branches",
+                     numSubnets, sizes.str(), partition.cut.size());
+  for (auto comp : partition.cut)
+    SPDLOG_LOGGER_DEBUG(mSLog, "Cut branch {}", comp->name());
+
+  return partition;
+}
+
+void SystemPartitioner::applyTearing(const Partition &partition) {
+  for (auto comp : partition.cut) {
+    mSystem.removeComponent(comp->name());
+    mSystem.addTearComponent(comp);
+  }
+}
+
+void SystemPartitioner::applyDecoupling(const Partition &partition,
+                                        Logger::Level logLevel) {
+  for (auto comp : partition.cut) {
+    IdentifiedObject::Ptr decouplingLine;
+    IdentifiedObject::List lineComponents;
+
+    if (auto line = std::dynamic_pointer_cast<DP::Ph1::PiLine>(comp)) {
+      if (**line->mParallelCond != 0)
+        SPDLOG_LOGGER_WARN(mSLog, "Conductance of {} is neglected",
+                           line->name());
+      auto dline = Signal::DecouplingLine::make(
+          line->name(), line->node(0), line->node(1), **line->mSeriesRes,
+          **line->mSeriesInd, **line->mParallelCap, logLevel);
+      decouplingLine = dline;
+      lineComponents = dline->getLineComponents();
+    } else if (auto line = std::dynamic_pointer_cast<EMT::Ph3::PiLine>(comp)) {
+      if (!(**line->mParallelCond).isZero())
+        SPDLOG_LOGGER_WARN(mSLog, "Conductance of {} is neglected",
+                           line->name());
+      auto dline = Signal::DecouplingLineEMT_Ph3::make(line->name(), logLevel);
+      dline->setParameters(line->node(0), line->node(1), **line->mSeriesRes,
+                           **line->mSeriesInd, **line->mParallelCap);
+      decouplingLine = dline;
+      lineComponents = dline->getLineComponents();
+    } else {
+      throw SystemError("Component " + comp->name() +
+                        " cannot be replaced by a decoupling line");
+    }
+
+    mSystem.removeComponent(comp->name());
+    mSystem.addComponent(decouplingLine);
+    mSystem.addComponents(lineComponents);
+  }
+}
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: Apache-2.0
+
+#include <chrono>
+#include <iostream>
+
+#include <DPsim.h>
+#include <dpsim-villas/InterfaceVillasQueueless.h>
+
+using namespace DPsim;
+
+// Measures the per-step cost of InterfaceVillasQueueless with a VILLASnode
+// loopback node, without a simulation around it. Every step writes a sample
+// with all exports, which the loopback node hands back to the imports.
+// The exports are sent with write batches of the given sizes, the imports
+// are read once a batch has been written. The exit code is non-zero if the
+// imports did not receive the exported values.
+//
+// Usage: VillasLoopbackBenchmark [signals] [steps]
+
+static Real runBenchmark(UInt numSignals, UInt numSteps, UInt batchSize,
+                         bool &valid) {
+  std::string loopbackConfig = R"STRING({
+      "type": "loopback",
+      "queuelen": 1024
+    })STRING";
+
+  auto intf = std::make_shared<InterfaceVillasQueueless>(
+      loopbackConfig, "loopback", spdlog::level::off);
+  intf->setWriteBatchSize(batchSize);
+
+  std::vector<CPS::Attribute<Real>::Ptr> exports;
+  std::vector<CPS::Attribute<Real>::Ptr> imports;
+  for (UInt i = 0; i < numSignals; i++) {
+    exports.push_back(CPS::AttributeStatic<Real>::make(i));
+    imports.push_back(CPS::AttributeStatic<Real>::make(0));
+    intf->addExport(exports.back());
+    intf->addImport(imports.back());
+  }
+
+  intf->open();
+  CPS::Task::Ptr readTask, writeTask;
+  for (auto task : intf->getTasks()) {
+    if (task->toString() == "loopback.Read")
+      readTask = task;
+    else
+      writeTask = task;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  for (UInt step = 0; step < numSteps; step++) {
+    **exports[0] = step;
+    writeTask->execute(step, step);
+    if ((step + 1) % batchSize == 0) {
+      for (UInt i = 0; i < batchSize; i++)
+        readTask->execute(step, step);
+    }
+  }
+  std::chrono::duration<Real> wall = std::chrono::steady_clock::now() - start;
+  intf->close();
+
+  valid = **imports[0] == (numSteps / batchSize) * batchSize - 1;
+  if (!valid)
+    std::cerr << "Unexpected last import value " << **imports[0] << std::endl;
+
+  return wall.count() / numSteps * 1e6;
+}
+
+int main(int argc, char *argv[]) {
+  UInt numSignals = argc > 1 ? std::stoul(argv[1]) : 16;
+  UInt numSteps = argc > 2 ? std::stoul(argv[2]) : 100000;
+
+  bool allValid = true;
+  for (UInt batchSize : {1, 10}) {
+    bool valid = false;
+    Real perStep = runBenchmark(numSignals, numSteps, batchSize, valid);
+    std::cout << numSignals << " signals, write batch " << batchSize << ": "
+              << perStep << " us per step" << std::endl;
+    allValid = allValid && valid;
+  }
+
+  return allValid ? 0 : 1;
+}
@@ -54,6 +54,26 @@ public:
 
   virtual void printVillasSignals() const;
 
+  /// Conversion between an attribute value and a sample entry
+  enum class Conversion { Real, Int, Bool, Complex };
+
+  /// Access to one attribute, compiled when the interface is opened.
+  /// `value` points to the data of static attributes, dynamic attributes
+  /// are read and written through `attr`.
+  struct PlanEntry {
+    Conversion kind;
+    void *value;
+    CPS::AttributeBase *attr;
+  };
+
+  /// Send the exports of `batchSize` steps with one write to the node.
+  /// Samples are delayed by up to `batchSize - 1` steps, so this is meant
+  /// for downsampled links whose peer does not run in lockstep. Has to be
+  /// set before the interface is opened.
+  void setWriteBatchSize(UInt batchSize);
+  /// Stamp every sample with the wall clock time it was produced at
+  void setSampleTimestamps(bool enable) { mSampleTimestamps = enable; }
+
   virtual ~InterfaceVillasQueueless() {
     if (mOpened) {
       try {
@@ -76,6 +96,20 @@ protected:
   Int mSequenceToDpsim;
   Int mSequenceFromDpsim;
 
+  std::vector<PlanEntry> mExportPlan;
+  std::vector<PlanEntry> mImportPlan;
+  node::SignalList::Ptr mOutputSignals;
+
+  UInt mWriteBatchSize = 1;
+  bool mSampleTimestamps = true;
+  std::vector<node::Sample *> mWriteBatch;
+  /// Step end of each sample in the batch, see LatencyHistogram::now
+  std::vector<uint64_t> mWriteBatchTimes;
+
+  void compilePlans();
+  /// Write and release all samples collected in the current batch
+  void flushWriteBatch();
+
 public:
   class PreStep : public CPS::Task {
   public:
@@ -33,11 +33,11 @@ public:
 private:
   static Bool villasInitialized;
 
-  std::vector<
-      std::tuple<std::function<CPS::AttributeBase::Ptr(Sample *)>, UInt>>
+  // Conversions between sample entries and frame values
+  std::vector<std::tuple<std::function<bool(Sample *, Real *)>, UInt>>
       mImports;
-  std::vector<std::tuple<std::function<void(CPS::AttributeBase::Ptr, Sample *)>,
-                         UInt, Bool>>
+  std::vector<std::tuple<std::function<void(const Real *, Sample *)>, UInt,
+                         Bool>>
       mExports;
 
   // VILLASnode node to send / receive data to / from
@@ -62,15 +62,8 @@ public:
   void open() override;
   void close() override;
 
-  void readValuesFromEnv(
-      std::vector<InterfaceQueued::AttributePacket> &updatedAttrs) override;
-  void readValuesFromEnv(
-      std::vector<std::tuple<CPS::AttributeBase::Ptr, UInt, bool, bool>>
-          &updatedAttrs);
-  void writeValuesToEnv(
-      std::vector<InterfaceQueued::AttributePacket> &updatedAttrs) override;
-  void writeValuesToEnv(
-      std::vector<std::tuple<CPS::AttributeBase::Ptr, UInt>> &updatedAttrs);
+  bool readValuesFromEnv(InterfaceFrame &frame) override;
+  void writeValuesToEnv(const InterfaceFrame &frame) override;
 
   virtual void configureImport(UInt attributeId, const std::type_info &type,
                                UInt idx, const String &name = "",
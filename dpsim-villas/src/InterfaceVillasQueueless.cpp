@@ -3,6 +3,8 @@
  * SPDX-License-Identifier: MPL-2.0
  */
 
+#include <algorithm>
+
 #include <dpsim-villas/InterfaceVillasQueueless.h>
 #include <dpsim-villas/InterfaceWorkerVillas.h>
 #include <memory>
@@ -65,7 +67,8 @@ void InterfaceVillasQueueless::createNode() {
     std::exit(1);
   }
   struct villas::node::memory::Type *pool_mt = &villas::node::memory::heap;
-  ret = node::pool_init(&mSamplePool, 16,
+  // A full write batch has to fit into the pool besides the samples in use
+  ret = node::pool_init(&mSamplePool, std::max<UInt>(16, 2 * mWriteBatchSize),
                         sizeof(node::Sample) + SAMPLE_DATA_LENGTH(64), pool_mt);
   if (ret < 0) {
     SPDLOG_LOGGER_ERROR(mLog,
@@ -137,9 +140,96 @@ void InterfaceVillasQueueless::createSignals() {
   }
 }
 
+void InterfaceVillasQueueless::setWriteBatchSize(UInt batchSize) {
+  if (mOpened) {
+    SPDLOG_LOGGER_ERROR(
+        mLog, "Cannot modify interface configuration after simulation start!");
+    std::exit(1);
+  }
+  mWriteBatchSize = std::max<UInt>(batchSize, 1);
+}
+
+static InterfaceVillasQueueless::PlanEntry
+compilePlanEntry(const AttributeBase::Ptr &attr) {
+  using Conversion = InterfaceVillasQueueless::Conversion;
+  InterfaceVillasQueueless::PlanEntry entry{Conversion::Real, nullptr,
+                                            attr.get()};
+  const std::type_info &type = attr->getType();
+
+  if (type == typeid(Real)) {
+    entry.kind = Conversion::Real;
+    if (attr->isStatic())
+      entry.value = std::dynamic_pointer_cast<Attribute<Real>>(attr.getPtr())
+                        ->asRawPointer()
+                        .get();
+  } else if (type == typeid(Int)) {
+    entry.kind = Conversion::Int;
+    if (attr->isStatic())
+      entry.value = std::dynamic_pointer_cast<Attribute<Int>>(attr.getPtr())
+                        ->asRawPointer()
+                        .get();
+  } else if (type == typeid(Bool)) {
+    entry.kind = Conversion::Bool;
+    if (attr->isStatic())
+      entry.value = std::dynamic_pointer_cast<Attribute<Bool>>(attr.getPtr())
+                        ->asRawPointer()
+                        .get();
+  } else if (type == typeid(Complex)) {
+    entry.kind = Conversion::Complex;
+    if (attr->isStatic())
+      entry.value =
+          std::dynamic_pointer_cast<Attribute<Complex>>(attr.getPtr())
+              ->asRawPointer()
+              .get();
+  } else {
+    throw RuntimeError("Unsupported attribute type!");
+  }
+  return entry;
+}
+
+void InterfaceVillasQueueless::compilePlans() {
+  mExportPlan.clear();
+  for (const auto &[attr, _seqId] : mExportAttrsDpsim)
+    mExportPlan.push_back(compilePlanEntry(attr));
+
+  mImportPlan.clear();
+  for (const auto &[attr, _seqId, _blockOnRead, _syncOnStart] :
+       mImportAttrsDpsim)
+    mImportPlan.push_back(compilePlanEntry(attr));
+}
+
+/// Value of a plan entry, directly for static attributes
+template <typename T>
+static inline T &planValue(const InterfaceVillasQueueless::PlanEntry &entry) {
+  if (entry.value)
+    return *static_cast<T *>(entry.value);
+  return static_cast<Attribute<T> *>(entry.attr)->get();
+}
+
+template <typename T>
+static inline void
+setPlanValue(const InterfaceVillasQueueless::PlanEntry &entry, T value) {
+  if (entry.value)
+    *static_cast<T *>(entry.value) = value;
+  else
+    static_cast<Attribute<T> *>(entry.attr)->set(value);
+}
+
 void InterfaceVillasQueueless::open() {
   createNode();
   createSignals();
+  try {
+    compilePlans();
+  } catch (const std::exception &) {
+    SPDLOG_LOGGER_ERROR(mLog, "Error: Unsupported attribute type!");
+    throw;
+  }
+  mOutputSignals = mNode->getOutputSignals(false);
+  mWriteBatch.clear();
+  mWriteBatch.reserve(mWriteBatchSize);
+  mWriteBatchTimes.clear();
+  mWriteBatchTimes.reserve(mWriteBatchSize);
+  mStatistics.reset();
 
   // We have no SuperNode, so just hope type_start doesn't use it...
   mNode->getFactory()->start(nullptr);
@@ -160,6 +250,7 @@ void InterfaceVillasQueueless::open() {
 
 void InterfaceVillasQueueless::close() {
   SPDLOG_LOGGER_INFO(mLog, "Closing InterfaceVillas...");
+  flushWriteBatch();
   int ret = mNode->stop();
   if (ret < 0) {
     SPDLOG_LOGGER_ERROR(
@@ -182,6 +273,7 @@ void InterfaceVillasQueueless::close() {
 
   delete mNode;
   mOpened = false;
+  mStatistics.log(mLog, mName);
 }
 
 CPS::Task::List InterfaceVillasQueueless::getTasks() {
@@ -198,15 +290,13 @@ CPS::Task::List InterfaceVillasQueueless::getTasks() {
 
 void InterfaceVillasQueueless::PreStep::execute(Real time, Int timeStepCount) {
   auto seqnum = mIntf.readFromVillas();
-  static size_t overrunCounter = 0;
   if (seqnum != mIntf.mSequenceToDpsim + 1) {
-    overrunCounter++;
-  }
-  if (overrunCounter > 10000) {
-    SPDLOG_LOGGER_WARN(mIntf.mLog, "{} Overrun(s) detected!", overrunCounter);
-    overrunCounter = 0;
+    auto overruns = ++mIntf.mStatistics.importOverruns;
+    if (overruns % 10000 == 0)
+      SPDLOG_LOGGER_WARN(mIntf.mLog, "{} Overrun(s) detected!", overruns);
   }
   mIntf.mSequenceToDpsim = seqnum;
+  mIntf.checkRoundTripProbe();
 }
 
 Int InterfaceVillasQueueless::readFromVillas() {
@@ -243,33 +333,35 @@ Int InterfaceVillasQueueless::readFromVillas() {
           "Received Sample length does not match configured attributes length");
     }
 
-    for (size_t i = 0; i < mImportAttrsDpsim.size(); i++) {
-      auto attr = std::get<0>(mImportAttrsDpsim[i]);
-      if (attr->getType() == typeid(Real)) {
-        auto attrReal =
-            std::dynamic_pointer_cast<Attribute<Real>>(attr.getPtr());
-        attrReal->set(sample->data[i].f);
-      } else if (attr->getType() == typeid(Int)) {
-        auto attrInt = std::dynamic_pointer_cast<Attribute<Int>>(attr.getPtr());
-        attrInt->set(sample->data[i].i);
-        if (i == 0) {
-          seqnum = sample->data[i].i;
-        }
-      } else if (attr->getType() == typeid(Bool)) {
-        auto attrBool =
-            std::dynamic_pointer_cast<Attribute<Bool>>(attr.getPtr());
-        attrBool->set(sample->data[i].b);
-      } else if (attr->getType() == typeid(Complex)) {
-        auto attrComplex =
-            std::dynamic_pointer_cast<Attribute<Complex>>(attr.getPtr());
-        attrComplex->set(
-            Complex(sample->data[i].z.real(), sample->data[i].z.imag()));
-      } else {
-        SPDLOG_LOGGER_ERROR(mLog, "Error: Unsupported attribute type!");
-        throw RuntimeError("Unsupported attribute type!");
+    for (size_t i = 0; i < mImportPlan.size(); i++) {
+      const auto &entry = mImportPlan[i];
+      const auto &data = sample->data[i];
+      switch (entry.kind) {
+      case Conversion::Real:
+        setPlanValue<Real>(entry, data.f);
+        break;
+      case Conversion::Int:
+        setPlanValue<Int>(entry, static_cast<Int>(data.i));
+        if (i == 0)
+          seqnum = static_cast<Int>(data.i);
+        break;
+      case Conversion::Bool:
+        setPlanValue<Bool>(entry, data.b);
+        break;
+      case Conversion::Complex:
+        setPlanValue<Complex>(entry, Complex(data.z.real(), data.z.imag()));
+        break;
       }
     }
 
+    if (sample->flags & (int)villas::node::SampleFlags::HAS_TS_RECEIVED) {
+      struct timespec now;
+      clock_gettime(CLOCK_REALTIME, &now);
+      int64_t delay = (now.tv_sec - sample->ts.received.tv_sec) * 1000000000LL +
+                    (now.tv_nsec - sample->ts.received.tv_nsec);
+      mStatistics.importApply.record(delay > 0 ? delay : 0);
+    }
+
     sample_decref(sample);
   } catch (const std::exception &) {
     if (sample)
@@ -288,70 +380,81 @@ void InterfaceVillasQueueless::writeToVillas() {
   if (mExportAttrsDpsim.size() == 0) {
     return;
   }
-  node::Sample *sample = nullptr;
-  Int ret = 0;
-  try {
-    sample = node::sample_alloc(&mSamplePool);
-    if (sample == nullptr) {
-      SPDLOG_LOGGER_ERROR(mLog, "InterfaceVillas could not allocate a new "
-                                "sample! Not sending any data!");
-      return;
-    }
+  uint64_t stepEnd = LatencyHistogram::now();
+  node::Sample *sample = node::sample_alloc(&mSamplePool);
+  if (sample == nullptr) {
+    mStatistics.droppedExports++;
+    SPDLOG_LOGGER_ERROR(mLog, "InterfaceVillas could not allocate a new "
+                              "sample! Not sending any data!");
+    return;
+  }
 
-    sample->signals = mNode->getOutputSignals(false);
-
-    for (size_t i = 0; i < mExportAttrsDpsim.size(); i++) {
-      auto attr = std::get<0>(mExportAttrsDpsim[i]);
-      if (attr->getType() == typeid(Real)) {
-        auto attrReal =
-            std::dynamic_pointer_cast<Attribute<Real>>(attr.getPtr());
-        sample->data[i].f = attrReal->get();
-      } else if (attr->getType() == typeid(Int)) {
-        auto attrInt = std::dynamic_pointer_cast<Attribute<Int>>(attr.getPtr());
-        sample->data[i].i = attrInt->get();
-      } else if (attr->getType() == typeid(Bool)) {
-        auto attrBool =
-            std::dynamic_pointer_cast<Attribute<Bool>>(attr.getPtr());
-        sample->data[i].b = attrBool->get();
-      } else if (attr->getType() == typeid(Complex)) {
-        auto attrComplex =
-            std::dynamic_pointer_cast<Attribute<Complex>>(attr.getPtr());
-        sample->data[i].z = std::complex<float>(attrComplex->get().real(),
-                                                attrComplex->get().imag());
-      } else {
-        SPDLOG_LOGGER_ERROR(mLog, "Error: Unsupported attribute type!");
-        throw RuntimeError("Unsupported attribute type!");
-      }
+  stampRoundTripProbe();
+  sample->signals = mOutputSignals;
+  for (size_t i = 0; i < mExportPlan.size(); i++) {
+    const auto &entry = mExportPlan[i];
+    auto &data = sample->data[i];
+    switch (entry.kind) {
+    case Conversion::Real:
+      data.f = planValue<Real>(entry);
+      break;
+    case Conversion::Int:
+      data.i = planValue<Int>(entry);
+      break;
+    case Conversion::Bool:
+      data.b = planValue<Bool>(entry);
+      break;
+    case Conversion::Complex: {
+      const Complex &value = planValue<Complex>(entry);
+      data.z = std::complex<float>(value.real(), value.imag());
+      break;
     }
+    }
+  }
 
-    sample->length = mExportAttrsDpsim.size();
-    sample->sequence = mSequenceFromDpsim++;
-    sample->flags |= (int)villas::node::SampleFlags::HAS_SEQUENCE;
-    sample->flags |= (int)villas::node::SampleFlags::HAS_DATA;
+  sample->length = mExportAttrsDpsim.size();
+  sample->sequence = mSequenceFromDpsim++;
+  sample->flags |= (int)villas::node::SampleFlags::HAS_SEQUENCE;
+  sample->flags |= (int)villas::node::SampleFlags::HAS_DATA;
+  if (mSampleTimestamps) {
     clock_gettime(CLOCK_REALTIME, &sample->ts.origin);
     sample->flags |= (int)villas::node::SampleFlags::HAS_TS_ORIGIN;
+  }
 
-    do {
-      ret = mNode->write(&sample, 1);
-    } while (ret == 0);
-    if (ret < 0)
-      SPDLOG_LOGGER_ERROR(mLog,
-                          "Failed to write samples to InterfaceVillas. Write "
-                          "returned code {}",
-                          ret);
+  mWriteBatch.push_back(sample);
+  mWriteBatchTimes.push_back(stepEnd);
+  if (mWriteBatch.size() >= mWriteBatchSize)
+    flushWriteBatch();
+}
 
-    sample_decref(sample);
+void InterfaceVillasQueueless::flushWriteBatch() {
+  size_t written = 0;
+  Int ret = 0;
+  try {
+    while (written < mWriteBatch.size()) {
+      ret = mNode->write(mWriteBatch.data() + written,
+                         mWriteBatch.size() - written);
+      if (ret < 0)
+        break;
+      written += ret;
+    }
   } catch (const std::exception &) {
-    sample_decref(sample);
+    // Don't throw here, the samples are released below
+  }
+  if (ret < 0)
+    SPDLOG_LOGGER_ERROR(
+        mLog,
+        "Failed to write samples to InterfaceVillas. Write returned code {}",
+        ret);
 
-    if (ret < 0)
-      SPDLOG_LOGGER_ERROR(
-          mLog,
-          "Failed to write samples to InterfaceVillas. Write returned code {}",
-          ret);
+  mStatistics.droppedExports += mWriteBatch.size() - written;
+  for (size_t i = 0; i < written; i++)
+    mStatistics.exportHandoff.recordSince(mWriteBatchTimes[i]);
 
-    // Don't throw here, because we managed to send something
-  }
+  for (auto sample : mWriteBatch)
+    sample_decref(sample);
+  mWriteBatch.clear();
+  mWriteBatchTimes.clear();
 }
 
 void InterfaceVillasQueueless::syncImports() {
@@ -360,8 +463,9 @@ void InterfaceVillasQueueless::syncImports() {
 }
 
 void InterfaceVillasQueueless::syncExports() {
-  // Just push all the attributes
+  // Just push all the attributes, without waiting for a batch to fill up
   this->writeToVillas();
+  this->flushWriteBatch();
 }
 
 void InterfaceVillasQueueless::printVillasSignals() const {
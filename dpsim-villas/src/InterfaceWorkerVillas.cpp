@@ -189,11 +189,11 @@ void InterfaceWorkerVillas::close() {
   delete mNode;
 }
 
-void InterfaceWorkerVillas::readValuesFromEnv(
-    std::vector<InterfaceQueued::AttributePacket> &updatedAttrs) {
+bool InterfaceWorkerVillas::readValuesFromEnv(InterfaceFrame &frame) {
   Sample *sample = nullptr;
   int ret = 0;
   bool shouldRead = false;
+  bool updated = false;
   try {
     auto pollFds = mNode->getPollFDs();
 
@@ -216,7 +216,7 @@ void InterfaceWorkerVillas::readValuesFromEnv(
       }
 
       if (ret == 0) {
-        return;
+        return false;
       }
 
       for (const auto &pfd : pfds) {
@@ -245,12 +245,10 @@ void InterfaceWorkerVillas::readValuesFromEnv(
 
       if (ret != 0) {
         for (UInt i = 0; i < mImports.size(); i++) {
-          auto importedAttr = std::get<0>(mImports[i])(sample);
-          if (!importedAttr.isNull()) {
-            updatedAttrs.emplace_back(InterfaceQueued::AttributePacket{
-                importedAttr, i, mCurrentSequenceInterfaceToDpsim,
-                InterfaceQueued::AttributePacketFlags::PACKET_NO_FLAGS});
-            mCurrentSequenceInterfaceToDpsim++;
+          if (std::get<0>(mImports[i])(sample,
+                                       mImportLayout.values(frame, i))) {
+            frame.updated[i] = 1;
+            updated = true;
           }
         }
 
@@ -285,28 +283,13 @@ void InterfaceWorkerVillas::readValuesFromEnv(
 
     throw;
   }
+  return updated;
 }
 
-void InterfaceWorkerVillas::writeValuesToEnv(
-    std::vector<InterfaceQueued::AttributePacket> &updatedAttrs) {
-  // Update export sequence IDs
-  for (const auto &packet : updatedAttrs) {
-    if (std::get<1>(mExports[packet.attributeId]) < packet.sequenceId) {
-      std::get<1>(mExports[packet.attributeId]) = packet.sequenceId;
-    }
-  }
-
-  // Remove outdated packets
-  auto beginOutdated = std::remove_if(
-      updatedAttrs.begin(), updatedAttrs.end(), [this](auto packet) {
-        return std::get<1>(mExports[packet.attributeId]) > packet.sequenceId;
-      });
-  updatedAttrs.erase(beginOutdated, updatedAttrs.end());
-
+void InterfaceWorkerVillas::writeValuesToEnv(const InterfaceFrame &frame) {
   Sample *sample = nullptr;
   Int ret = 0;
   bool done = false;
-  bool sampleFilled = false;
   try {
     sample = node::sample_alloc(&mSamplePool);
     if (sample == nullptr) {
@@ -315,50 +298,33 @@ void InterfaceWorkerVillas::writeValuesToEnv(
       return;
     }
 
+    // A frame always holds all exports of one step, so the sample is
+    // complete and waitForOnWrite does not need to be considered
     sample->signals = mNode->getOutputSignals(false);
-    auto beginExported = std::remove_if(
-        updatedAttrs.begin(), updatedAttrs.end(),
-        [this, &sampleFilled, &sample](auto packet) {
-          if (!std::get<2>(mExports[packet.attributeId])) {
-            //Write attribute to sample ASAP
-            std::get<0>(mExports[packet.attributeId])(packet.value, sample);
-            sampleFilled = true;
-            return true;
-          }
-          return false;
-        });
-    updatedAttrs.erase(beginExported, updatedAttrs.end());
-
-    //Check if the remaining packets form a complete set
-    if (((long)updatedAttrs.size()) ==
-        std::count_if(mExports.cbegin(), mExports.cend(),
-                      [](auto x) { return std::get<2>(x); })) {
-      for (const auto &packet : updatedAttrs) {
-        std::get<0>(mExports[packet.attributeId])(packet.value, sample);
-      }
-      sampleFilled = true;
-      updatedAttrs.clear();
+    for (UInt i = 0; i < mExports.size(); i++) {
+      if (!frame.updated[i])
+        continue;
+      std::get<0>(mExports[i])(mExportLayout.values(frame, i), sample);
+      std::get<1>(mExports[i]) = frame.sequenceId;
     }
 
-    if (sampleFilled) {
-      sample->sequence = mSequence++;
-      sample->flags |= (int)villas::node::SampleFlags::HAS_SEQUENCE;
-      sample->flags |= (int)villas::node::SampleFlags::HAS_DATA;
-      clock_gettime(CLOCK_REALTIME, &sample->ts.origin);
-      sample->flags |= (int)villas::node::SampleFlags::HAS_TS_ORIGIN;
-      done = true;
-
-      do {
-        ret = mNode->write(&sample, 1);
-      } while (ret == 0);
-      if (ret < 0)
-        SPDLOG_LOGGER_ERROR(mLog,
-                            "Failed to write samples to InterfaceVillas. Write "
-                            "returned code {}",
-                            ret);
+    sample->sequence = mSequence++;
+    sample->flags |= (int)villas::node::SampleFlags::HAS_SEQUENCE;
+    sample->flags |= (int)villas::node::SampleFlags::HAS_DATA;
+    clock_gettime(CLOCK_REALTIME, &sample->ts.origin);
+    sample->flags |= (int)villas::node::SampleFlags::HAS_TS_ORIGIN;
+    done = true;
 
-      sample_copy(mLastSample, sample);
-    }
+    do {
+      ret = mNode->write(&sample, 1);
+    } while (ret == 0);
+    if (ret < 0)
+      SPDLOG_LOGGER_ERROR(mLog,
+                          "Failed to write samples to InterfaceVillas. Write "
+                          "returned code {}",
+                          ret);
+
+    sample_copy(mLastSample, sample);
     sample_decref(sample);
   } catch (const std::exception &) {
     /* We need to at least send something, so determine where exactly the
@@ -413,76 +379,52 @@ void InterfaceWorkerVillas::configureExport(UInt attributeId,
 
   if (type == typeid(Int)) {
     mExports.emplace_back(
-        [idx](AttributeBase::Ptr attr, Sample *smp) {
+        [idx](const Real *value, Sample *smp) {
           if (idx >= smp->capacity)
             throw std::out_of_range("not enough space in allocated sample");
           if (idx >= smp->length)
             smp->length = idx + 1;
 
-          Attribute<Int>::Ptr attrTyped =
-              std::dynamic_pointer_cast<Attribute<Int>>(attr.getPtr());
-
-          if (attrTyped.isNull())
-            throw InvalidAttributeException();
-
-          smp->data[idx].i = **attrTyped;
+          smp->data[idx].i = static_cast<int64_t>(value[0]);
         },
         0, waitForOnWrite);
     mExportSignals[idx] =
         std::make_shared<node::Signal>(name, unit, node::SignalType::INTEGER);
   } else if (type == typeid(Real)) {
     mExports.emplace_back(
-        [idx](AttributeBase::Ptr attr, Sample *smp) {
+        [idx](const Real *value, Sample *smp) {
           if (idx >= smp->capacity)
             throw std::out_of_range("not enough space in allocated sample");
           if (idx >= smp->length)
             smp->length = idx + 1;
 
-          Attribute<Real>::Ptr attrTyped =
-              std::dynamic_pointer_cast<Attribute<Real>>(attr.getPtr());
-
-          if (attrTyped.isNull())
-            throw InvalidAttributeException();
-
-          smp->data[idx].f = **attrTyped;
+          smp->data[idx].f = value[0];
         },
         0, waitForOnWrite);
     mExportSignals[idx] =
         std::make_shared<node::Signal>(name, unit, node::SignalType::FLOAT);
   } else if (type == typeid(Complex)) {
     mExports.emplace_back(
-        [idx](AttributeBase::Ptr attr, Sample *smp) {
+        [idx](const Real *value, Sample *smp) {
           if (idx >= smp->capacity)
             throw std::out_of_range("not enough space in allocated sample");
           if (idx >= smp->length)
             smp->length = idx + 1;
 
-          Attribute<Complex>::Ptr attrTyped =
-              std::dynamic_pointer_cast<Attribute<Complex>>(attr.getPtr());
-
-          if (attrTyped.isNull())
-            throw InvalidAttributeException();
-
-          smp->data[idx].z = **attrTyped;
+          smp->data[idx].z = std::complex<float>(value[0], value[1]);
         },
         0, waitForOnWrite);
     mExportSignals[idx] =
         std::make_shared<node::Signal>(name, unit, node::SignalType::COMPLEX);
   } else if (type == typeid(Bool)) {
     mExports.emplace_back(
-        [idx](AttributeBase::Ptr attr, Sample *smp) {
+        [idx](const Real *value, Sample *smp) {
           if (idx >= smp->capacity)
             throw std::out_of_range("not enough space in allocated sample");
           if (idx >= smp->length)
             smp->length = idx + 1;
 
-          Attribute<Bool>::Ptr attrTyped =
-              std::dynamic_pointer_cast<Attribute<Bool>>(attr.getPtr());
-
-          if (attrTyped.isNull())
-            throw InvalidAttributeException();
-
-          smp->data[idx].b = **attrTyped;
+          smp->data[idx].b = value[0] != 0;
         },
         0, waitForOnWrite);
     mExportSignals[idx] =
@@ -518,56 +460,57 @@ void InterfaceWorkerVillas::configureImport(UInt attributeId,
 
   if (type == typeid(Int)) {
     mImports.emplace_back(
-        [idx, log](Sample *smp) -> AttributeBase::Ptr {
+        [idx, log](Sample *smp, Real *value) {
           if (idx >= smp->length) {
             SPDLOG_LOGGER_ERROR(
                 log, "incomplete data received from InterfaceVillas");
-            return nullptr;
+            return false;
           }
-          return AttributePointer<AttributeBase>(
-              AttributeStatic<Int>::make(smp->data[idx].i));
+          value[0] = static_cast<Real>(smp->data[idx].i);
+          return true;
         },
         0);
     mImportSignals[idx] =
         std::make_shared<node::Signal>(name, unit, node::SignalType::INTEGER);
   } else if (type == typeid(Real)) {
     mImports.emplace_back(
-        [idx, log](Sample *smp) -> AttributeBase::Ptr {
+        [idx, log](Sample *smp, Real *value) {
           if (idx >= smp->length) {
             SPDLOG_LOGGER_ERROR(
                 log, "incomplete data received from InterfaceVillas");
-            return nullptr;
+            return false;
           }
-          return AttributePointer<AttributeBase>(
-              AttributeStatic<Real>::make(smp->data[idx].f));
+          value[0] = smp->data[idx].f;
+          return true;
         },
         0);
     mImportSignals[idx] =
         std::make_shared<node::Signal>(name, unit, node::SignalType::FLOAT);
   } else if (type == typeid(Complex)) {
     mImports.emplace_back(
-        [idx, log](Sample *smp) -> AttributeBase::Ptr {
+        [idx, log](Sample *smp, Real *value) {
           if (idx >= smp->length) {
             SPDLOG_LOGGER_ERROR(
                 log, "incomplete data received from InterfaceVillas");
-            return nullptr;
+            return false;
           }
-          return AttributePointer<AttributeBase>(
-              AttributeStatic<Complex>::make(smp->data[idx].z));
+          value[0] = smp->data[idx].z.real();
+          value[1] = smp->data[idx].z.imag();
+          return true;
         },
         0);
     mImportSignals[idx] =
         std::make_shared<node::Signal>(name, unit, node::SignalType::COMPLEX);
   } else if (type == typeid(Bool)) {
     mImports.emplace_back(
-        [idx, log](Sample *smp) -> AttributeBase::Ptr {
+        [idx, log](Sample *smp, Real *value) {
           if (idx >= smp->length) {
             SPDLOG_LOGGER_ERROR(
                 log, "incomplete data received from InterfaceVillas");
-            return nullptr;
+            return false;
           }
-          return AttributePointer<AttributeBase>(
-              AttributeStatic<Bool>::make(smp->data[idx].b));
+          value[0] = smp->data[idx].b ? 1 : 0;
+          return true;
         },
         0);
     mImportSignals[idx] =
@@ -0,0 +1,121 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <DPsim.h>
+#include <dpsim-models/SystemPartitioner.h>
+
+using namespace DPsim;
+using namespace CPS::DP;
+using namespace CPS::DP::Ph1;
+
+// Square mesh of pi-lines with a resistive load at every node, split
+// automatically into subnets. The split is used for diakoptics with
+// -o mode=tear or for decoupling lines with -o mode=decouple. The number of
+// subnets is set with -o parts=<n> and the mesh width with -o size=<n>.
+
+int main(int argc, char *argv[]) {
+  Real timeStep = 0.00005;
+  Real finalTime = 0.1;
+  UInt size = 6;
+  UInt numParts = 2;
+  String mode = "tear";
+
+  CommandLineArgs args(argc, argv);
+  if (args.options.find("size") != args.options.end())
+    size = args.getOptionInt("size");
+  if (args.options.find("parts") != args.options.end())
+    numParts = args.getOptionInt("parts");
+  if (args.options.find("mode") != args.options.end())
+    mode = args.getOptionString("mode");
+  if (mode != "tear" && mode != "decouple")
+    throw std::invalid_argument("mode must be tear or decouple");
+
+  String simName = "DP_Partitioned_Mesh_" + mode;
+  Logger::setLogDir("logs/" + simName);
+
+  SystemNodeList nodes;
+  SystemComponentList comps;
+  std::vector<SimNode::Ptr> mesh;
+
+  for (UInt i = 0; i < size * size; ++i) {
+    auto n = SimNode::make("n" + std::to_string(i));
+    mesh.push_back(n);
+    nodes.push_back(n);
+
+    auto load = Resistor::make("load" + std::to_string(i));
+    load->setParameters(1000);
+    load->connect(SimNode::List{n, SimNode::GND});
+    comps.push_back(load);
+  }
+
+  auto addLine = [&](UInt from, UInt to) {
+    auto line =
+        PiLine::make("line" + std::to_string(from) + "_" + std::to_string(to));
+    // Travelling time sqrt(LC) = 1 ms, larger than the time step
+    line->setParameters(1, 0.1, 1e-5);
+    line->connect(SimNode::List{mesh[from], mesh[to]});
+    comps.push_back(line);
+  };
+
+  for (UInt row = 0; row < size; ++row) {
+    for (UInt col = 0; col < size; ++col) {
+      UInt k = row * size + col;
+      if (col + 1 < size)
+        addLine(k, k + 1);
+      if (row + 1 < size)
+        addLine(k, k + size);
+    }
+  }
+
+  // Source behind an internal resistance at the first node
+  auto nSource = SimNode::make("n_source");
+  nodes.push_back(nSource);
+  auto vs = VoltageSource::make("vs");
+  vs->setParameters(CPS::Math::polar(10e3, 0));
+  vs->connect(SimNode::List{SimNode::GND, nSource});
+  auto rSource = Resistor::make("r_source");
+  rSource->setParameters(1);
+  rSource->connect(SimNode::List{nSource, mesh[0]});
+  comps.push_back(vs);
+  comps.push_back(rSource);
+
+  auto sys = SystemTopology(50, nodes, comps);
+
+  auto partitionMode = mode == "tear"
+                           ? CPS::SystemPartitioner::Mode::Tearing
+                           : CPS::SystemPartitioner::Mode::Decoupling;
+  CPS::SystemPartitioner partitioner(sys, partitionMode, timeStep);
+  auto partition = partitioner.partition(numParts);
+  if (mode == "tear")
+    partitioner.applyTearing(partition);
+  else
+    partitioner.applyDecoupling(partition);
+
+  std::cout << "Cut " << partition.cut.size() << " lines, subnet sizes:";
+  for (auto subnetSize : partition.subnetSizes)
+    std::cout << " " << subnetSize;
+  std::cout << std::endl;
+
+  // Logging
+  auto logger = DataLogger::make(simName);
+  logger->logAttribute("v0", mesh.front()->attribute("v"));
+  logger->logAttribute("v_end", mesh.back()->attribute("v"));
+
+  Simulation sim(simName, Logger::Level::off);
+  sim.setSystem(sys);
+  if (mode == "tear")
+    sim.setTearingComponents(sys.mTearComponents);
+  sim.setTimeStep(timeStep);
+  sim.setFinalTime(finalTime);
+  sim.doSplitSubnets(true);
+  sim.addLogger(logger);
+
+  sim.run();
+
+  return 0;
+}
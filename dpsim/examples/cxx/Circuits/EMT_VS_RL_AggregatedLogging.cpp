@@ -0,0 +1,65 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <DPsim.h>
+
+using namespace DPsim;
+using namespace CPS::EMT;
+using namespace CPS::EMT::Ph1;
+
+int main(int argc, char *argv[]) {
+  // Define simulation scenario
+  Real timeStep = 20e-6;
+  Real finalTime = 0.2;
+  String simName = "EMT_VS_RL_AggregatedLogging";
+  Logger::setLogDir("logs/" + simName);
+
+  // Nodes
+  auto n1 = SimNode::make("n1");
+  auto n2 = SimNode::make("n2");
+
+  // Components
+  auto vs = VoltageSource::make("vs");
+  vs->setParameters(Complex(10, 0), 50);
+  auto r1 = Resistor::make("r_1");
+  r1->setParameters(5);
+  auto l1 = Inductor::make("l_1");
+  l1->setParameters(0.02);
+
+  // Topology
+  vs->connect(SimNode::List{SimNode::GND, n1});
+  r1->connect(SimNode::List{n1, n2});
+  l1->connect(SimNode::List{n2, SimNode::GND});
+
+  auto sys = SystemTopology(50, SystemNodeList{n1, n2},
+                            SystemComponentList{vs, r1, l1});
+
+  // Full resolution reference
+  auto logger = DataLogger::make(simName);
+  logger->logAttribute("v2", n2->attribute("v"));
+  logger->logAttribute("i_l", l1->attribute("i_intf"));
+
+  // One row per millisecond which keeps the peaks of the waveforms
+  auto aggLogger = AggregatingDataLogger::make(
+      simName + "_1ms", 50,
+      AggregatingDataLogger::DefaultStatistics | AggregatingDataLogger::Last);
+  aggLogger->logAttribute("v2", n2->attribute("v"));
+  aggLogger->logAttribute("i_l", l1->attribute("i_intf"));
+
+  Simulation sim(simName);
+  sim.setSystem(sys);
+  sim.setTimeStep(timeStep);
+  sim.setFinalTime(finalTime);
+  sim.setDomain(Domain::EMT);
+  sim.addLogger(logger);
+  sim.addLogger(aggLogger);
+
+  sim.run();
+
+  return 0;
+}
@@ -0,0 +1,77 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <cmath>
+
+#include <DPsim.h>
+
+using namespace DPsim;
+using namespace CPS::EMT;
+using namespace CPS::EMT::Ph1;
+
+// Sweeps the resistance of an RL load and evaluates the RMS current of the
+// last period of every run in memory, without writing any result files.
+int main(int argc, char *argv[]) {
+  Real timeStep = 20e-6;
+  Real finalTime = 0.2;
+  Real frequency = 50;
+  Real inductance = 0.02;
+  String simName = "EMT_VS_RL_InMemoryLogging";
+  Logger::setLogDir("logs/" + simName);
+
+  for (Real resistance : {1., 2., 5., 10., 20.}) {
+    // Nodes
+    auto n1 = SimNode::make("n1");
+    auto n2 = SimNode::make("n2");
+
+    // Components
+    auto vs = VoltageSource::make("vs");
+    vs->setParameters(Complex(10, 0), frequency);
+    auto r1 = Resistor::make("r_1");
+    r1->setParameters(resistance);
+    auto l1 = Inductor::make("l_1");
+    l1->setParameters(inductance);
+
+    // Topology
+    vs->connect(SimNode::List{SimNode::GND, n1});
+    r1->connect(SimNode::List{n1, n2});
+    l1->connect(SimNode::List{n2, SimNode::GND});
+
+    auto sys = SystemTopology(frequency, SystemNodeList{n1, n2},
+                              SystemComponentList{vs, r1, l1});
+
+    auto logger = InMemoryDataLogger::make(finalTime, timeStep);
+    logger->logAttribute("i_l", l1->attribute("i_intf"));
+
+    Simulation sim(simName, Logger::Level::off);
+    sim.setSystem(sys);
+    sim.setTimeStep(timeStep);
+    sim.setFinalTime(finalTime);
+    sim.setDomain(Domain::EMT);
+    sim.addLogger(logger);
+    sim.run();
+
+    // RMS over the last period
+    const auto &current = logger->getColumn("i_l");
+    size_t periodRows = static_cast<size_t>(1 / frequency / timeStep + 0.5);
+    Real sumSquares = 0;
+    for (size_t i = current.size() - periodRows; i < current.size(); i++)
+      sumSquares += current[i] * current[i];
+    Real rms = std::sqrt(sumSquares / periodRows);
+
+    // The source voltage is given as a peak value
+    Real expected =
+        10 / std::sqrt(2) /
+        std::abs(Complex(resistance, 2 * PI * frequency * inductance));
+    std::cout << "R = " << resistance << " Ohm: " << logger->rowCount()
+              << " rows, I_rms = " << rms << " A (expected " << expected
+              << " A)" << std::endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,77 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <DPsim.h>
+
+using namespace DPsim;
+using namespace CPS::EMT;
+using namespace CPS::EMT::Ph1;
+
+int main(int argc, char *argv[]) {
+  // Define simulation scenario
+  Real timeStep = 20e-6;
+  Real finalTime = 1;
+  String simName = "EMT_VS_RL_TriggeredLogging";
+  Logger::setLogDir("logs/" + simName);
+
+  // Nodes
+  auto n1 = SimNode::make("n1");
+  auto n2 = SimNode::make("n2");
+  auto n3 = SimNode::make("n3");
+
+  // Components
+  auto vs = VoltageSource::make("vs");
+  vs->setParameters(Complex(1000, 0), 50);
+  auto r1 = Resistor::make("r_1");
+  r1->setParameters(1);
+  auto l1 = Inductor::make("l_1");
+  l1->setParameters(0.02);
+  auto load = Resistor::make("r_load");
+  load->setParameters(100);
+  auto fault = Switch::make("fault");
+  fault->setParameters(1e6, 0.1);
+  fault->open();
+
+  // Topology
+  vs->connect(SimNode::List{SimNode::GND, n1});
+  r1->connect(SimNode::List{n1, n2});
+  l1->connect(SimNode::List{n2, n3});
+  load->connect(SimNode::List{n3, SimNode::GND});
+  fault->connect(SimNode::List{n3, SimNode::GND});
+
+  auto sys = SystemTopology(50, SystemNodeList{n1, n2, n3},
+                            SystemComponentList{vs, r1, l1, load, fault});
+
+  // Keep 5 ms before and 20 ms after every switching action at full
+  // resolution, otherwise only log every millisecond
+  auto logger = TriggeredDataLogger::make(simName, 250, 1000, 50);
+  logger->logAttribute("v3", n3->attribute("v"));
+  logger->logAttribute("i_line", r1->attribute("i_intf"));
+  logger->logAttribute("i_fault", fault->attribute("i_intf"));
+  logger->addSwitchTrigger(fault);
+  // Also capture overcurrents in the line
+  logger->addThresholdTrigger(r1->mIntfCurrent->deriveCoeff<Real>(0, 0), 50,
+                              TriggeredDataLogger::Edge::Rising);
+
+  Simulation sim(simName);
+  sim.setSystem(sys);
+  sim.setTimeStep(timeStep);
+  sim.setFinalTime(finalTime);
+  sim.setDomain(Domain::EMT);
+  sim.addLogger(logger);
+
+  sim.addEvent(SwitchEvent::make(0.3, fault, true));
+  sim.addEvent(SwitchEvent::make(0.4, fault, false));
+
+  sim.run();
+
+  std::cout << "Captured " << logger->triggerCount() << " trigger windows"
+            << std::endl;
+
+  return 0;
+}
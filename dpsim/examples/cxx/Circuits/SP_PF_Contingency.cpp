@@ -0,0 +1,116 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <chrono>
+
+#include <DPsim.h>
+#include <dpsim/PFContingencyAnalysis.h>
+
+using namespace DPsim;
+using namespace CPS;
+
+// N-1 line outage screening of a meshed synthetic grid. Every bus is fed by
+// the bus at (i - 1) / 2 and sibling buses are connected by tie lines. An
+// ideal transformer without impedance parallels the first tie line. The
+// power flow ignores it, so it must not be screened as an outage. The
+// size can be set with -o buses=<n> and the number of threads with
+// -o threads=<n>.
+
+int main(int argc, char *argv[]) {
+  String simName = "SP_PF_Contingency";
+  UInt numBuses = 200;
+  UInt numThreads = 0;
+
+  CommandLineArgs args(argc, argv);
+  if (args.options.find("buses") != args.options.end())
+    numBuses = args.getOptionInt("buses");
+  if (args.options.find("threads") != args.options.end())
+    numThreads = args.getOptionInt("threads");
+
+  Logger::setLogDir("logs/" + simName);
+
+  Real Vnom = 20e3;
+  SimNode<Complex>::List buses;
+  SystemNodeList nodes;
+  SystemComponentList comps;
+
+  for (UInt i = 0; i < numBuses; ++i) {
+    buses.push_back(
+        SimNode<Complex>::make("n" + std::to_string(i), PhaseType::Single));
+    nodes.push_back(buses.back());
+  }
+
+  auto extnet = SP::Ph1::NetworkInjection::make("Slack");
+  extnet->setParameters(Vnom);
+  extnet->setBaseVoltage(Vnom);
+  extnet->modifyPowerFlowBusType(PowerflowBusType::VD);
+  extnet->connect({buses[0]});
+  comps.push_back(extnet);
+
+  auto addLine = [&](String name, UInt from, UInt to) {
+    auto line = SP::Ph1::PiLine::make(name);
+    line->setParameters(0.1, 1e-3, 1e-8);
+    line->setBaseVoltage(Vnom);
+    line->connect({buses[from], buses[to]});
+    comps.push_back(line);
+  };
+
+  for (UInt i = 1; i < numBuses; ++i) {
+    addLine("line" + std::to_string(i), (i - 1) / 2, i);
+    if (i % 2 == 0)
+      addLine("tie" + std::to_string(i), i - 1, i);
+
+    auto load = SP::Ph1::Load::make("load" + std::to_string(i));
+    load->setParameters(50e3, 20e3, Vnom);
+    load->modifyPowerFlowBusType(PowerflowBusType::PQ);
+    load->connect({buses[i]});
+    comps.push_back(load);
+  }
+
+  auto idealTrafo = SP::Ph1::Transformer::make("trafo_ideal");
+  if (numBuses > 2) {
+    idealTrafo->setParameters(Vnom, Vnom, 1, 0, 0, 0);
+    idealTrafo->setBaseVoltage(Vnom);
+    idealTrafo->connect({buses[1], buses[2]});
+    comps.push_back(idealTrafo);
+  }
+
+  auto analysis = std::make_shared<PFContingencyAnalysis>(
+      simName, SystemTopology(50, nodes, comps), 1, Logger::Level::off);
+  analysis->setSolverAndComponentBehaviour(Solver::Behaviour::Initialization);
+  analysis->doInitFromNodesAndTerminals(false);
+  analysis->setNumThreads(numThreads);
+  analysis->setVoltageLimits(0.95, 1.05);
+  analysis->setBranchLimit("line1", 8e6);
+  analysis->setBranchLimit("line2", 8e6);
+  analysis->initialize();
+
+  auto start = std::chrono::steady_clock::now();
+  auto results = analysis->run();
+  std::chrono::duration<double> duration =
+      std::chrono::steady_clock::now() - start;
+
+  UInt converged = 0, islanded = 0, violations = 0;
+  Real solveTime = 0;
+  for (auto &result : results) {
+    if (result.branch == idealTrafo->name())
+      throw std::logic_error("Ideal transformer was screened as an outage");
+    converged += result.converged;
+    islanded += result.islanded;
+    violations += !result.violations.empty();
+    solveTime += result.solveTime;
+  }
+
+  std::cout << results.size() << " outages: " << converged << " converged, "
+            << islanded << " islanded, " << violations
+            << " with violations, mean case time "
+            << solveTime / results.size() * 1e3 << " ms, total "
+            << duration.count() << " s" << std::endl;
+
+  return 0;
+}
@@ -0,0 +1,112 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <chrono>
+
+#include <DPsim.h>
+#include <dpsim/PFSolverTimeSeries.h>
+
+using namespace DPsim;
+using namespace CPS;
+
+// Annual quasi-static time-series powerflow of a synthetic tree-shaped feeder
+// with hourly load profiles. The size can be set with -o buses=<n>, the
+// number of hours with -o hours=<n> and the Jacobian reuse with
+// -o reuse=<contraction>, where 0 recomputes the Jacobian in every iteration.
+// With -o write=true the voltages are written to a CSV file.
+
+int main(int argc, char *argv[]) {
+  String simName = "SP_PF_Feeder_QSTS";
+  UInt numBuses = 1000;
+  UInt numHours = 8760;
+  Real reuse = 0.25;
+  Bool write = false;
+
+  CommandLineArgs args(argc, argv);
+  if (args.options.find("buses") != args.options.end())
+    numBuses = args.getOptionInt("buses");
+  if (args.options.find("hours") != args.options.end())
+    numHours = args.getOptionInt("hours");
+  if (args.options.find("reuse") != args.options.end())
+    reuse = args.getOptionReal("reuse");
+  if (args.options.find("write") != args.options.end())
+    write = args.getOptionBool("write");
+
+  Logger::setLogDir("logs/" + simName);
+
+  Real Vnom = 20e3;
+  Real hour = 3600;
+  SimNode<Complex>::List buses;
+  SystemNodeList nodes;
+  SystemComponentList comps;
+
+  for (UInt i = 0; i < numBuses; ++i) {
+    buses.push_back(
+        SimNode<Complex>::make("n" + std::to_string(i), PhaseType::Single));
+    nodes.push_back(buses.back());
+  }
+
+  auto extnet = SP::Ph1::NetworkInjection::make("Slack");
+  extnet->setParameters(Vnom);
+  extnet->setBaseVoltage(Vnom);
+  extnet->modifyPowerFlowBusType(PowerflowBusType::VD);
+  extnet->connect({buses[0]});
+  comps.push_back(extnet);
+
+  for (UInt i = 1; i < numBuses; ++i) {
+    // Every bus is fed by the bus at (i - 1) / 2
+    auto line = SP::Ph1::PiLine::make("line" + std::to_string(i));
+    line->setParameters(0.1, 1e-3, 1e-8);
+    line->setBaseVoltage(Vnom);
+    line->connect({buses[(i - 1) / 2], buses[i]});
+    comps.push_back(line);
+
+    auto load = SP::Ph1::Load::make("load" + std::to_string(i));
+    load->setParameters(10e3, 5e3, Vnom);
+    load->modifyPowerFlowBusType(PowerflowBusType::PQ);
+    load->connect({buses[i]});
+
+    // Daily and seasonal variation with a phase shift per load
+    load->mLoadProfile.gridStart = 0;
+    load->mLoadProfile.gridStep = hour;
+    load->mLoadProfile.pqGrid.resize(numHours);
+    for (UInt h = 0; h < numHours; ++h) {
+      Real scale = 1 + 0.4 * std::sin(2 * PI * (h + i % 24) / 24.) +
+                   0.2 * std::cos(2 * PI * h / 8760.);
+      load->mLoadProfile.pqGrid[h] = {10e3 * scale, 5e3 * scale};
+    }
+    load->use_profile = true;
+    comps.push_back(load);
+  }
+
+  auto solver = std::make_shared<PFSolverTimeSeries>(
+      simName, SystemTopology(50, nodes, comps), hour, Logger::Level::off);
+  solver->setSolverAndComponentBehaviour(Solver::Behaviour::Initialization);
+  solver->doInitFromNodesAndTerminals(false);
+  solver->setReuseContraction(reuse);
+  solver->initialize();
+
+  auto start = std::chrono::steady_clock::now();
+  solver->solveTimeSeries(0, numHours);
+  std::chrono::duration<double> duration =
+      std::chrono::steady_clock::now() - start;
+
+  UInt converged = 0;
+  for (auto it : solver->resultIterations())
+    if (it >= 0)
+      ++converged;
+
+  std::cout << numBuses << " buses, " << numHours << " hours: " << converged
+            << " converged, " << solver->numFactorizations()
+            << " factorizations, " << duration.count() << " s" << std::endl;
+
+  if (write)
+    solver->writeResults("logs/" + simName + "/" + simName + ".csv");
+
+  return 0;
+}
@@ -0,0 +1,82 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <DPsim.h>
+
+using namespace DPsim;
+using namespace CPS;
+
+// Power flow of a synthetic tree-shaped feeder to measure how the solver
+// scales with the number of buses. The size can be set with -o buses=<n> and
+// the fast decoupled solver is selected with -o solver=FDLF.
+
+int main(int argc, char *argv[]) {
+  String simName = "SP_PF_Feeder_Scaling";
+  UInt numBuses = 1000;
+  auto solverType = Solver::Type::NRP;
+
+  CommandLineArgs args(argc, argv);
+  if (args.options.find("buses") != args.options.end())
+    numBuses = args.getOptionInt("buses");
+  if (args.options.find("solver") != args.options.end() &&
+      args.getOptionString("solver") == "FDLF")
+    solverType = Solver::Type::FDLF;
+
+  Logger::setLogDir("logs/" + simName);
+
+  Real Vnom = 20e3;
+  SimNode<Complex>::List buses;
+  SystemNodeList nodes;
+  SystemComponentList comps;
+
+  for (UInt i = 0; i < numBuses; ++i) {
+    buses.push_back(
+        SimNode<Complex>::make("n" + std::to_string(i), PhaseType::Single));
+    nodes.push_back(buses.back());
+  }
+
+  auto extnet = SP::Ph1::NetworkInjection::make("Slack");
+  extnet->setParameters(Vnom);
+  extnet->setBaseVoltage(Vnom);
+  extnet->modifyPowerFlowBusType(PowerflowBusType::VD);
+  extnet->connect({buses[0]});
+  comps.push_back(extnet);
+
+  for (UInt i = 1; i < numBuses; ++i) {
+    // Every bus is fed by the bus at (i - 1) / 2
+    auto line = SP::Ph1::PiLine::make("line" + std::to_string(i));
+    line->setParameters(0.1, 1e-3, 1e-8);
+    line->setBaseVoltage(Vnom);
+    line->connect({buses[(i - 1) / 2], buses[i]});
+    comps.push_back(line);
+
+    auto load = SP::Ph1::Load::make("load" + std::to_string(i));
+    load->setParameters(10e3, 5e3, Vnom);
+    load->modifyPowerFlowBusType(PowerflowBusType::PQ);
+    load->connect({buses[i]});
+    comps.push_back(load);
+  }
+
+  Simulation sim(simName, Logger::Level::off);
+  sim.setSystem(SystemTopology(50, nodes, comps));
+  sim.setTimeStep(1);
+  sim.setFinalTime(5);
+  sim.setDomain(Domain::SP);
+  sim.setSolverType(solverType);
+  sim.setSolverAndComponentBehaviour(Solver::Behaviour::Initialization);
+  sim.doInitFromNodesAndTerminals(false);
+  sim.run();
+
+  Real sum = 0;
+  for (auto t : sim.stepTimes())
+    sum += t;
+  std::cout << numBuses << " buses: mean power flow solve time "
+            << sum / sim.stepTimes().size() * 1e3 << " ms" << std::endl;
+
+  return 0;
+}
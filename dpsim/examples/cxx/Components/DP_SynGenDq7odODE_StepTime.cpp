@@ -0,0 +1,120 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <DPsim.h>
+
+using namespace DPsim;
+using namespace CPS::DP;
+using namespace CPS::DP::Ph3;
+
+// Measures the mean step time of a simulation whose generator is integrated
+// by the ODE solver. The number of generators can be set with -o gens=<n>,
+// each one feeding its own load. With -o coupled=true all generators share a
+// single integrator, which integrates implicitly with -o implicit=true.
+
+int main(int argc, char *argv[]) {
+  // Define simulation parameters
+  Real timeStep = 0.0001;
+  Real finalTime = 0.5;
+  UInt numGens = 1;
+  Bool coupled = false;
+  Bool implicit = false;
+  String simName = "DP_SynGenDq7odODE_StepTime";
+
+  CommandLineArgs args(argc, argv);
+  if (args.options.find("gens") != args.options.end())
+    numGens = args.getOptionInt("gens");
+  if (args.options.find("coupled") != args.options.end())
+    coupled = args.getOptionBool("coupled");
+  if (args.options.find("implicit") != args.options.end())
+    implicit = args.getOptionBool("implicit");
+  Logger::setLogDir("logs/" + simName);
+
+  // Define machine parameters in per unit
+  Real nomPower = 555e6;
+  Real nomPhPhVoltRMS = 24e3;
+  Real nomFreq = 60;
+  Real nomFieldCurr = 1300;
+  Int poleNum = 2;
+  Real H = 3.7;
+  Real Rs = 0.003;
+  Real Ll = 0.15;
+  Real Lmd = 1.6599;
+  Real Lmq = 1.61;
+  Real Rfd = 0.0006;
+  Real Llfd = 0.1648;
+  Real Rkd = 0.0284;
+  Real Llkd = 0.1713;
+  Real Rkq1 = 0.0062;
+  Real Llkq1 = 0.7252;
+  Real Rkq2 = 0.0237;
+  Real Llkq2 = 0.125;
+  // Initialization parameters
+  Real initActivePower = 300e6;
+  Real initReactivePower = 0;
+  Real initMechPower = 300e6;
+  Real initTerminalVolt = 24000 / sqrt(3) * sqrt(2);
+  Real initVoltAngle = -PI / 2;
+
+  // Define grid parameters
+  // resistance for 300 MW output
+  Real Rload = 1.92;
+
+  // Nodes
+  std::vector<Complex> initVoltN1 = std::vector<Complex>(
+      {Complex(initTerminalVolt * cos(initVoltAngle),
+               initTerminalVolt * sin(initVoltAngle)),
+       Complex(initTerminalVolt * cos(initVoltAngle - 2 * PI / 3),
+               initTerminalVolt * sin(initVoltAngle - 2 * PI / 3)),
+       Complex(initTerminalVolt * cos(initVoltAngle + 2 * PI / 3),
+               initTerminalVolt * sin(initVoltAngle + 2 * PI / 3))});
+  SystemNodeList nodes;
+  SystemComponentList comps;
+  for (UInt g = 0; g < numGens; ++g) {
+    auto n = SimNode::make("n" + std::to_string(g), PhaseType::ABC,
+                           initVoltN1);
+
+    std::shared_ptr<Ph3::SynchronGeneratorDQ> gen =
+        Ph3::SynchronGeneratorDQODE::make("SynGen" + std::to_string(g));
+    gen->setParametersFundamentalPerUnit(
+        nomPower, nomPhPhVoltRMS, nomFreq, poleNum, nomFieldCurr, Rs, Ll, Lmd,
+        Lmq, Rfd, Llfd, Rkd, Llkd, Rkq1, Llkq1, Rkq2, Llkq2, H,
+        initActivePower, initReactivePower, initTerminalVolt, initVoltAngle,
+        initMechPower);
+    gen->connect({n});
+
+    auto res = Ph3::SeriesResistor::make("R_load" + std::to_string(g));
+    res->setParameters(Rload);
+    res->connect({SimNode::GND, n});
+
+    nodes.push_back(n);
+    comps.push_back(gen);
+    comps.push_back(res);
+  }
+
+  // System
+  auto sys = SystemTopology(60, nodes, comps);
+
+  // Simulation
+  Simulation sim(simName, Logger::Level::off);
+  sim.setSystem(sys);
+  sim.setTimeStep(timeStep);
+  sim.setFinalTime(finalTime);
+  sim.setDomain(Domain::DP);
+  sim.setSolverType(Solver::Type::MNA);
+  sim.doCoupledODESolver(coupled, implicit);
+  sim.run();
+
+  Real sum = 0;
+  for (auto t : sim.stepTimes())
+    sum += t;
+  std::cout << numGens << " generators: mean step time "
+            << sum / sim.stepTimes().size() * 1e6 << " us" << std::endl;
+
+  return 0;
+}
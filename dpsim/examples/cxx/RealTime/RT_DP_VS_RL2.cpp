@@ -42,10 +42,24 @@ int main(int argc, char *argv[]) {
   auto sys = SystemTopology(50, SystemNodeList{SimNode::GND, n1, n2, n3},
                             SystemComponentList{vs, rl, ll, rL});
 
+  // Bounded-memory logger: one second of rows, drained while running
+  std::filesystem::path logFilename =
+      "logs/" + simName + "/" + simName + ".csv";
+  auto logger = RealTimeDataLogger::make(logFilename, 10000,
+                                         RealTimeDataLogger::Mode::Stream);
+  logger->logAttribute("v3", n3->mVoltage);
+  logger->logAttribute("i_load", rL->mIntfCurrent);
+
   RealTimeSimulation sim(simName);
   sim.setSystem(sys);
   sim.setTimeStep(timeStep);
   sim.setFinalTime(finalTime);
+  sim.addLogger(logger);
+
+  // Lock the memory and warm up the solver before the timed loop, then spin
+  // for the last microseconds before each step
+  sim.setPreflight(RealTimeSimulation::Preflight());
+  sim.setTimerMode(Timer::Mode::Hybrid);
 
   auto startIn = std::chrono::seconds(5);
   sim.run(startIn);
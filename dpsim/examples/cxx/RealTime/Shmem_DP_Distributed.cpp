@@ -0,0 +1,143 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <chrono>
+
+#include <DPsim.h>
+
+using namespace DPsim;
+using namespace CPS::DP;
+using namespace CPS::DP::Ph1;
+
+// Simple circuit split into two processes which exchange their interface
+// values through InterfaceShmem, without VILLASnode. The supply side is
+// started with -s 0, the load side with -s 1. The coupling is an ideal
+// transformer: a voltage source on the supply side and a current source on
+// the load side, whose values come from the respective other process.
+// Both sides block on their imports, so the two simulations run in
+// lockstep. Busy polling instead of futex wake-up is selected with
+// -o wait=busy. The load side echoes a counter of the supply side, from
+// which the supply side measures the round trip time. With -o delay=<k>
+// the imports are consumed k steps later, so that each side can run ahead
+// of the other, and -o extrapolation=linear compensates for the delay.
+
+int main(int argc, char *argv[]) {
+  CommandLineArgs args(argc, argv, "Shmem_DP_Distributed", 0.001, 1);
+
+  if (args.scenario != 0 && args.scenario != 1) {
+    std::cerr << "select the side with -s 0 or -s 1" << std::endl;
+    std::exit(1);
+  }
+
+  auto waitMode = InterfaceShmem::WaitMode::Futex;
+  if (args.options.find("wait") != args.options.end() &&
+      args.getOptionString("wait") == "busy")
+    waitMode = InterfaceShmem::WaitMode::BusyPoll;
+
+  UInt delay = 0;
+  if (args.options.find("delay") != args.options.end())
+    delay = static_cast<UInt>(args.getOptionInt("delay"));
+  auto extrapolation = ImportExtrapolation::Hold;
+  if (args.options.find("extrapolation") != args.options.end() &&
+      args.getOptionString("extrapolation") == "linear")
+    extrapolation = ImportExtrapolation::Linear;
+
+  String simName = args.name + "_" + std::to_string(args.scenario);
+  CPS::Logger::setLogDir("logs/" + simName);
+
+  SystemTopology sys;
+  InterfaceShmem::Ptr intf;
+  auto logger = DataLogger::make(simName);
+
+  if (args.scenario == 0) {
+    auto n1 = SimNode::make("n1", PhaseType::Single, std::vector<Complex>{10});
+    auto n2 = SimNode::make("n2", PhaseType::Single, std::vector<Complex>{5});
+
+    auto evs = VoltageSource::make("v_intf");
+    evs->setParameters(Complex(5, 0));
+    auto vs1 = VoltageSource::make("vs_1");
+    vs1->setParameters(Complex(10, 0));
+    auto r12 = Resistor::make("r_12");
+    r12->setParameters(1);
+
+    evs->connect({SimNode::GND, n2});
+    vs1->connect({SimNode::GND, n1});
+    r12->connect({n1, n2});
+
+    sys = SystemTopology(args.sysFreq, SystemNodeList{n1, n2},
+                         SystemComponentList{evs, vs1, r12});
+
+    intf = std::make_shared<InterfaceShmem>(
+        "/dpsim_shmem_01", "/dpsim_shmem_10", "intf", 64, waitMode);
+    intf->addImport(evs->mVoltageRef, true);
+    intf->addExport(evs->mIntfCurrent->deriveCoeff<Complex>(0, 0));
+
+    auto probe = CPS::AttributeStatic<Int>::make(0);
+    auto echo = CPS::AttributeStatic<Int>::make(0);
+    intf->addExport(probe);
+    intf->addImport(echo);
+    intf->setRoundTripProbe(probe, echo);
+
+    MatrixComp initialEvsCurrent = MatrixComp::Zero(1, 1);
+    initialEvsCurrent(0, 0) = Complex(5, 0);
+    evs->setIntfCurrent(initialEvsCurrent);
+
+    logger->logAttribute("v1", n1->mVoltage);
+    logger->logAttribute("v2", n2->mVoltage);
+    logger->logAttribute("i_evs", evs->mIntfCurrent);
+  } else {
+    auto n2 = SimNode::make("n2", PhaseType::Single, std::vector<Complex>{5});
+
+    auto ecs = CurrentSource::make("i_intf");
+    ecs->setParameters(Complex(5, 0));
+    auto r02 = Resistor::make("r_02");
+    r02->setParameters(1);
+
+    ecs->connect({SimNode::GND, n2});
+    r02->connect({SimNode::GND, n2});
+
+    sys = SystemTopology(args.sysFreq, SystemNodeList{n2},
+                         SystemComponentList{ecs, r02});
+
+    intf = std::make_shared<InterfaceShmem>(
+        "/dpsim_shmem_10", "/dpsim_shmem_01", "intf", 64, waitMode);
+    intf->addImport(ecs->mCurrentRef, true);
+    intf->addExport(ecs->mIntfVoltage->deriveCoeff<Complex>(0, 0)->deriveScaled(
+        Complex(-1., 0)));
+
+    auto probe = CPS::AttributeStatic<Int>::make(0);
+    intf->addImport(probe);
+    intf->addExport(probe);
+
+    logger->logAttribute("v2", n2->mVoltage);
+    logger->logAttribute("i_ecs", ecs->mIntfCurrent);
+  }
+
+  intf->setImportDelay(delay, extrapolation);
+
+  Simulation sim(simName, args.logLevel);
+  sim.setSystem(sys);
+  sim.setTimeStep(args.timeStep);
+  sim.setFinalTime(args.duration);
+  sim.addInterface(intf);
+  sim.addLogger(logger);
+
+  auto start = std::chrono::steady_clock::now();
+  sim.run();
+  std::chrono::duration<Real> wall = std::chrono::steady_clock::now() - start;
+
+  UInt steps = static_cast<UInt>(args.duration / args.timeStep + 0.5);
+  std::cout << "Side " << args.scenario << ": " << steps << " steps, "
+            << wall.count() / steps * 1e6 << " us per step" << std::endl;
+  const auto &stats = intf->getStatistics();
+  std::cout << "Import apply: " << stats.importApply.summary() << std::endl;
+  if (args.scenario == 0)
+    std::cout << "Round trip: " << stats.roundTrip.summary() << std::endl;
+
+  return 0;
+}
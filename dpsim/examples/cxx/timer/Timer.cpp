@@ -19,6 +19,11 @@ int main(int argc, char *argv[]) {
   t.setStartTime(args.startTime);
   t.setInterval(args.timeStep);
 
+  // Spin for the last part of each interval with -o mode=hybrid
+  if (args.options.find("mode") != args.options.end() &&
+      args.getOptionString("mode") == "hybrid")
+    t.setMode(Timer::Mode::Hybrid);
+
   if (args.startTime == Timer::StartTimePoint())
     args.startTime = Timer::StartClock::now();
 
@@ -36,4 +41,8 @@ int main(int argc, char *argv[]) {
   }
 
   t.stop();
+
+  std::cout << std::endl
+            << "Overruns: " << t.overruns() << std::endl
+            << "Wake-up lateness: " << t.lateness().summary() << std::endl;
 }
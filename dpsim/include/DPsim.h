@@ -8,6 +8,9 @@
 
 #include <dpsim/Config.h>
 #include <dpsim/Simulation.h>
+#include <dpsim/AggregatingDataLogger.h>
+#include <dpsim/InMemoryDataLogger.h>
+#include <dpsim/TriggeredDataLogger.h>
 #include <dpsim/Utils.h>
 
 #ifndef _MSC_VER
@@ -15,6 +18,10 @@
 #include <dpsim/RealTimeSimulation.h>
 #endif
 
+#ifdef WITH_RT
+#include <dpsim/InterfaceShmem.h>
+#endif
+
 #include <dpsim-models/Components.h>
 #include <dpsim-models/Logger.h>
 
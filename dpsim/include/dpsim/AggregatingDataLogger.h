@@ -0,0 +1,103 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <fstream>
+#include <vector>
+
+#include <dpsim-models/Attribute.h>
+#include <dpsim-models/Filesystem.h>
+#include <dpsim-models/PtrFactory.h>
+#include <dpsim-models/Task.h>
+#include <dpsim/DataLoggerInterface.h>
+#include <dpsim/Definitions.h>
+#include <dpsim/Scheduler.h>
+
+namespace DPsim {
+
+/// Logger which writes one row of statistics per window of steps instead of
+/// dropping steps like DataLogger's downsampling.
+///
+/// For every attribute, the enabled statistics are written as separate
+/// columns named `<attribute>.<statistic>`. The time column holds the time of
+/// the last step in the window.
+class AggregatingDataLogger : public DataLoggerInterface,
+                              public SharedFactory<AggregatingDataLogger> {
+
+public:
+  /// Statistics which can be combined as bit flags
+  enum Statistic : UInt {
+    Min = 1 << 0,
+    Max = 1 << 1,
+    Mean = 1 << 2,
+    RMS = 1 << 3,
+    Last = 1 << 4,
+  };
+  static constexpr UInt DefaultStatistics = Min | Max | Mean | RMS;
+
+protected:
+  String mName;
+  Bool mEnabled;
+  fs::path mFilename;
+  std::ofstream mLogFile;
+
+  UInt mWindowSteps;
+  UInt mStatistics;
+
+  std::vector<Column> mColumns;
+  /// Values of all columns in the current step
+  Eigen::ArrayXd mValues;
+  /// Running statistics of the current window
+  Eigen::ArrayXd mMin;
+  Eigen::ArrayXd mMax;
+  Eigen::ArrayXd mSum;
+  Eigen::ArrayXd mSumSquares;
+  UInt mWindowFill;
+  Real mLastTime;
+
+  String mBuffer;
+
+  void resetWindow();
+  void writeWindow();
+  void flushBuffer();
+
+public:
+  typedef std::shared_ptr<AggregatingDataLogger> Ptr;
+
+  /// @param windowSteps number of steps which are aggregated into one row
+  /// @param statistics combination of Statistic flags
+  AggregatingDataLogger(String name, UInt windowSteps,
+                        UInt statistics = DefaultStatistics,
+                        Bool enabled = true);
+  virtual ~AggregatingDataLogger(){};
+
+  virtual void start() override;
+  virtual void stop() override;
+
+  virtual void log(Real time, Int timeStepCount) override;
+
+  virtual CPS::Task::Ptr getTask() override;
+
+  class Step : public CPS::Task {
+  public:
+    Step(AggregatingDataLogger &logger)
+        : Task(logger.mName + ".Write"), mLogger(logger) {
+      for (auto attr : logger.mAttributes) {
+        mAttributeDependencies.push_back(attr.second);
+      }
+      mModifiedAttributes.push_back(Scheduler::external);
+    }
+
+    void execute(Real time, Int timeStepCount);
+
+  private:
+    AggregatingDataLogger &mLogger;
+  };
+};
+} // namespace DPsim
@@ -0,0 +1,114 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <dpsim/Solver.h>
+
+#include <dpsim-models/Solver/ODEInterface.h>
+
+#include <arkode/arkode.h>
+#include <arkode/arkode_direct.h>
+#include <nvector/nvector_serial.h>
+#include <sunlinsol/sunlinsol_dense.h>
+#include <sunmatrix/sunmatrix_dense.h>
+
+#ifdef WITH_SUNDIALS_KLU
+#include <sunlinsol/sunlinsol_klu.h>
+#include <sunmatrix/sunmatrix_sparse.h>
+#endif
+
+namespace DPsim {
+/// Solver for the ODEs of several components with a single integrator.
+///
+/// The states of all components are concatenated into one vector, so that
+/// error control and step size adaptation are shared instead of running one
+/// ARKode instance per component. For implicit integration the Jacobian is
+/// block diagonal; it is stored sparse and factorized by KLU if SUNDIALS
+/// provides it, dense otherwise.
+class CoupledODESolver : public Solver {
+protected:
+  /// Components and the offset of their states in the joint vector
+  std::vector<CPS::ODEInterface::Ptr> mComponents;
+  std::vector<Int> mOffsets;
+  std::vector<Int> mSizes;
+  /// Total number of states
+  Int mProbDim = 0;
+
+  /// Memory block allocated by ARKode
+  void *mArkode_mem{nullptr};
+  /// Joint state vector
+  N_Vector mStates{nullptr};
+  /// Indicates whether the ODE shall be solved using an implicit scheme
+  bool mImplicitIntegration;
+  /// Jacobian matrix and linear solver for implicit integration
+  SUNMatrix A{nullptr};
+  SUNLinearSolver LS{nullptr};
+  /// Scratch block for the dense Jacobian of a single component
+  CPS::Matrix mBlock;
+
+  /// Constant time step
+  Real mTimestep;
+
+  /// Relative tolerance
+  realtype reltol = RCONST(1.0e-6);
+  /// Scalar absolute tolerance
+  realtype abstol = RCONST(1.0e-10);
+
+  /// End time and state of the last step, the integrator continues there
+  Real mLastTime{0};
+  CPS::Vector mLastState;
+  bool mIntegratorStarted{false};
+
+  static int StateSpaceWrapper(realtype t, N_Vector y, N_Vector ydot,
+                               void *user_data);
+  int StateSpace(realtype t, N_Vector y, N_Vector ydot);
+
+  static int JacobianWrapper(realtype t, N_Vector y, N_Vector fy, SUNMatrix J,
+                             void *user_data, N_Vector tmp1, N_Vector tmp2,
+                             N_Vector tmp3);
+  int Jacobian(realtype t, N_Vector y, N_Vector fy, SUNMatrix J, N_Vector tmp1,
+               N_Vector tmp2, N_Vector tmp3);
+
+  /// Create the integrator memory, matrix and linear solver once
+  void createIntegrator(Real initial_time);
+  /// Throws if a SUNDIALS call failed
+  void checkFlag(int flag, const std::string &funcname);
+
+public:
+  CoupledODESolver(String name,
+                   const std::vector<CPS::ODEInterface::Ptr> &components,
+                   bool implicit_integration, Real timestep,
+                   CPS::Logger::Level logLevel = CPS::Logger::Level::info);
+  /// Deallocate all memory
+  ~CoupledODESolver();
+
+  class SolveTask : public CPS::Task {
+  public:
+    SolveTask(CoupledODESolver &solver)
+        : Task(solver.mName + ".Solve"), mSolver(solver) {
+      for (auto &comp : solver.mComponents) {
+        mAttributeDependencies.push_back(comp->mOdePreState);
+        mModifiedAttributes.push_back(comp->mOdePostState);
+      }
+    }
+
+    void execute(Real time, Int timeStepCount);
+
+  private:
+    CoupledODESolver &mSolver;
+  };
+
+  virtual CPS::Task::List getTasks() {
+    return CPS::Task::List{std::make_shared<SolveTask>(*this)};
+  }
+
+  /// Solve all component ODEs for the current time step
+  Real step(Real initial_time);
+};
+} // namespace DPsim
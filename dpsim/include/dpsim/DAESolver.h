@@ -24,6 +24,11 @@
 #include <sundials/sundials_types.h>
 #include <sunlinsol/sunlinsol_dense.h>
 
+#ifdef WITH_SUNDIALS_KLU
+#include <sunlinsol/sunlinsol_klu.h>
+#include <sunmatrix/sunmatrix_sparse.h>
+#endif
+
 namespace DPsim {
 
 /// Solver class which uses Differential Algebraic Equation(DAE) systems
@@ -65,6 +70,20 @@ protected:
   long int interalSteps = 0;
   long int resEval = 0;
   std::vector<CPS::DAEInterface::ResFn> mResidualFunctions;
+  std::vector<CPS::DAEInterface::JacFn> mJacobianFunctions;
+
+  /// Use the analytic Jacobian of the components if all of them provide one.
+  /// Off by default because this path has not been validated against the
+  /// difference quotient Jacobian yet.
+  bool mUseAnalyticJacobian = false;
+  /// True if all components provide an analytic Jacobian
+  bool mAnalyticJacobian = false;
+  /// True if the Jacobian is stored in a sparse matrix and factorized by KLU
+  bool mSparseJacobian = false;
+  /// Entries collected from the components in each Jacobian evaluation
+  CPS::DAEInterface::JacobianEntries mJacobianEntries;
+  /// Compressed column Jacobian assembled from the entries
+  Eigen::SparseMatrix<Real, Eigen::ColMajor, sunindextype> mJacobian;
 
   /// Residual Function of entire System
   static int residualFunctionWrapper(realtype ttime, N_Vector state,
@@ -73,6 +92,21 @@ protected:
   int residualFunction(realtype ttime, N_Vector state, N_Vector dstate_dt,
                        N_Vector resid);
 
+  /// Jacobian of the entire system, dF/dy + cj * dF/dy'
+  static int jacobianFunctionWrapper(realtype ttime, realtype cj,
+                                     N_Vector state, N_Vector dstate_dt,
+                                     N_Vector resid, SUNMatrix J,
+                                     void *user_data, N_Vector tmp1,
+                                     N_Vector tmp2, N_Vector tmp3);
+  int jacobianFunction(realtype ttime, realtype cj, N_Vector state,
+                       N_Vector dstate_dt, SUNMatrix J);
+  /// Collect the Jacobian entries of nodes and components. Returns false if
+  /// a component has no analytic Jacobian.
+  bool assembleJacobian(realtype ttime, realtype cj, const double state[],
+                        const double dstate_dt[]);
+  /// Attach matrix and linear solver to IDA
+  void createLinearSolver();
+
 public:
   /// Create solve object with given parameters
   DAESolver(String name, const CPS::SystemTopology &system, Real dt, Real mT0);
@@ -80,6 +114,9 @@ public:
   ~DAESolver();
   /// Initialize Components & Nodes with initial values
   void initialize() final;
+  /// Experimental: pass the analytic Jacobian of the components to IDA,
+  /// factorized by KLU if available. Must be set before initialize().
+  void setAnalyticJacobian(bool value) { mUseAnalyticJacobian = value; }
 
   /// Solve system for the current time
   Real step(Real time);
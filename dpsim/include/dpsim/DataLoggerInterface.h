@@ -22,6 +22,58 @@ class DataLoggerInterface {
 protected:
   std::map<String, CPS::AttributeBase::Ptr> mAttributes;
 
+  /// Logged attribute with its type resolved once in start(), so that
+  /// reading it needs no type check per step
+  struct Column {
+    enum class Kind { Real, Int, Bool };
+
+    Kind kind;
+    CPS::AttributeBase *attr;
+
+    /// Current value of the attribute, Int and Bool converted to Real
+    Real value() const {
+      switch (kind) {
+      case Kind::Int:
+        return static_cast<Real>(
+            static_cast<CPS::Attribute<Int> *>(attr)->get());
+      case Kind::Bool:
+        return static_cast<CPS::Attribute<Bool> *>(attr)->get() ? 1. : 0.;
+      default:
+        return static_cast<CPS::Attribute<Real> *>(attr)->get();
+      }
+    }
+  };
+
+  /// Size of the formatting buffer after which loggers write to their file
+  static constexpr size_t WRITE_CHUNK_SIZE = 1 << 20;
+
+  /// One column per logged attribute, in the order of the attribute names.
+  /// logAttribute already splits complex and matrix attributes into real
+  /// ones, other types throw with `loggerName` in the message.
+  std::vector<Column> resolveColumns(const String &loggerName) const {
+    using Kind = Column::Kind;
+
+    std::vector<Column> columns;
+    columns.reserve(mAttributes.size());
+    for (auto &it : mAttributes) {
+      CPS::AttributeBase *attr = it.second.getPtr().get();
+      const std::type_info &type = attr->getType();
+
+      if (type == typeid(Real)) {
+        columns.push_back({Kind::Real, attr});
+      } else if (type == typeid(Int)) {
+        columns.push_back({Kind::Int, attr});
+      } else if (type == typeid(Bool)) {
+        columns.push_back({Kind::Bool, attr});
+      } else {
+        throw std::runtime_error(loggerName +
+                                 ": Unsupported type for attribute " +
+                                 it.first);
+      }
+    }
+    return columns;
+  }
+
 public:
   typedef std::shared_ptr<DataLoggerInterface> Ptr;
   typedef std::vector<DataLoggerInterface::Ptr> List;
@@ -48,6 +100,9 @@ public:
     } else if (auto attrInt = std::dynamic_pointer_cast<CPS::Attribute<Int>>(
                    attr.getPtr())) {
       mAttributes[name] = attrInt;
+    } else if (auto attrBool = std::dynamic_pointer_cast<CPS::Attribute<Bool>>(
+                   attr.getPtr())) {
+      mAttributes[name] = attrBool;
     } else if (auto attrMatrix =
                    std::dynamic_pointer_cast<CPS::Attribute<Matrix>>(
                        attr.getPtr())) {
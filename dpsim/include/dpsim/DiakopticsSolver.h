@@ -12,6 +12,7 @@
 #include <dpsim-models/SimSignalComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
 #include <dpsim/DataLogger.h>
+#include <dpsim/MNASolverDirect.h>
 #include <dpsim/Solver.h>
 
 #include <unordered_map>
@@ -35,10 +36,16 @@ private:
     UInt mVirtualNodeNum;
     /// Offset of block in system matrix
     UInt sysOff;
-    /// Factorization of the subnet's block
-    CPS::LUFactorized luFactorization;
+    /// System matrix of the subnet
+    SparseMatrix systemMatrix;
+    /// Factorization of the subnet's system matrix
+    std::shared_ptr<DirectLinearSolver> linearSolver;
     /// List of all right side vector contributions
     std::vector<const Matrix *> rightVectorStamps;
+    /// Right side vector of the subnet
+    Matrix rightVector;
+    /// Tear currents mapped onto the subnet
+    Matrix mappedTearCurrents;
     /// Left-side vector of the subnet AFTER complete step
     CPS::Attribute<Matrix>::Ptr leftVector;
   };
@@ -61,12 +68,12 @@ private:
 
   Matrix mRightSideVector;
   Matrix mLeftSideVector;
-  /// Complete matrix in block form
-  Matrix mSystemMatrix;
-  /// Inverse of the complete system matrix (only used for initialization)
-  Matrix mSystemInverse;
+  /// Linear solver implementation for the subnets
+  DirectLinearSolverImpl mImplementation;
+  /// Configuration of the subnet linear solvers
+  DirectLinearSolverConfiguration mLinearSolverConfiguration;
   /// Topology of the network removal
-  Matrix mTearTopology;
+  SparseMatrix mTearTopology;
   /// Impedance of the removed network
   CPS::SparseMatrixRow mTearImpedance;
   /// (Factorization of the) impedance matrix for the removed network, including
@@ -94,7 +101,9 @@ private:
   void initComponents();
 
   void initMatrices();
-  void applyTearComponentStamp(UInt compIdx);
+  void applyTearComponentStamp(UInt compIdx,
+                               std::vector<Eigen::Triplet<Real>> &topology);
+  std::shared_ptr<DirectLinearSolver> createLinearSolver();
 
   void log(Real time, Int timeStepCount) override;
 
@@ -105,9 +114,15 @@ public:
   /// Solutions of the split systems
   const CPS::Attribute<Matrix>::Ptr mOrigLeftSideVector;
 
-  DiakopticsSolver(String name, CPS::SystemTopology system,
-                   CPS::IdentifiedObject::List tearComponents, Real timeStep,
-                   CPS::Logger::Level logLevel);
+  /// The subnets are factorized with the given linear solver implementation.
+  /// Undef selects KLU if available and SparseLU otherwise.
+  DiakopticsSolver(
+      String name, CPS::SystemTopology system,
+      CPS::IdentifiedObject::List tearComponents, Real timeStep,
+      CPS::Logger::Level logLevel,
+      DirectLinearSolverImpl implementation = DirectLinearSolverImpl::Undef,
+      DirectLinearSolverConfiguration configuration =
+          DirectLinearSolverConfiguration());
 
   CPS::Task::List getTasks() override;
 
@@ -39,6 +39,8 @@ public:
 
   Event(CPS::Real t) : mTime(t) {}
 
+  CPS::Real time() const { return mTime; }
+
   virtual ~Event() {}
 };
 
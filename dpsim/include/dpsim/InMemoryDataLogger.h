@@ -0,0 +1,93 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <dpsim-models/Attribute.h>
+#include <dpsim-models/PtrFactory.h>
+#include <dpsim-models/Task.h>
+#include <dpsim/DataLoggerInterface.h>
+#include <dpsim/Definitions.h>
+#include <dpsim/Scheduler.h>
+
+namespace DPsim {
+
+/// Logger which keeps all logged values in memory, one contiguous array per
+/// column, and never writes a file.
+///
+/// The columns are queried after the run with getColumn(). The column
+/// "time" holds the simulation time of each row. If the final time and the
+/// time step are known, the columns are preallocated in start(), otherwise
+/// they grow geometrically. Columns handed out by getSharedColumn() keep
+/// the values of their run when the logger is started again.
+class InMemoryDataLogger : public DataLoggerInterface,
+                           public SharedFactory<InMemoryDataLogger> {
+
+protected:
+  UInt mDownsampling;
+  /// Number of rows reserved in start(), zero if unknown
+  size_t mExpectedRows;
+
+  std::vector<Column> mColumns;
+  /// Names of mData, starting with "time"
+  std::vector<String> mNames;
+  /// Values of every column, mData[0] holds the time
+  std::vector<std::shared_ptr<std::vector<Real>>> mData;
+
+
+public:
+  typedef std::shared_ptr<InMemoryDataLogger> Ptr;
+
+  /// @param downsampling only every downsampling-th step is stored
+  InMemoryDataLogger(UInt downsampling = 1);
+  /// Preallocates the rows for a simulation of the given final time and step
+  InMemoryDataLogger(Real finalTime, Real timeStep, UInt downsampling = 1);
+  virtual ~InMemoryDataLogger(){};
+
+  /// Discards the rows of a previous run. Columns that are not shared are
+  /// reused, shared ones are replaced by new ones.
+  virtual void start() override;
+  virtual void stop() override {}
+
+  virtual void log(Real time, Int timeStepCount) override;
+
+  virtual CPS::Task::Ptr getTask() override;
+
+  /// Values of the column with the given name, or of the time for "time".
+  /// The reference stays valid until the logger is started again.
+  const std::vector<Real> &getColumn(const String &name) const {
+    return *getSharedColumn(name);
+  }
+  /// Like getColumn(), but the values outlive a restart of the logger
+  std::shared_ptr<const std::vector<Real>>
+  getSharedColumn(const String &name) const;
+  /// Names of all columns, starting with "time"
+  const std::vector<String> &columnNames() const { return mNames; }
+  /// Number of rows stored so far
+  size_t rowCount() const { return mData.empty() ? 0 : mData[0]->size(); }
+
+  class Step : public CPS::Task {
+  public:
+    Step(InMemoryDataLogger &logger)
+        : Task("InMemoryDataLogger.Write"), mLogger(logger) {
+      for (auto attr : logger.mAttributes) {
+        mAttributeDependencies.push_back(attr.second);
+      }
+      mModifiedAttributes.push_back(Scheduler::external);
+    }
+
+    void execute(Real time, Int timeStepCount);
+
+  private:
+    InMemoryDataLogger &mLogger;
+  };
+};
+} // namespace DPsim
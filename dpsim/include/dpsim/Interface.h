@@ -10,6 +10,8 @@
 #include <dpsim/Config.h>
 #include <dpsim/Definitions.h>
 #include <dpsim/Interface.h>
+#include <dpsim/InterfaceFrame.h>
+#include <dpsim/InterfaceStatistics.h>
 #include <dpsim/Scheduler.h>
 
 namespace DPsim {
@@ -54,6 +56,30 @@ public:
                          bool syncOnSimulationStart = true);
   virtual void addExport(CPS::AttributeBase::Ptr attr);
 
+  /// Estimate round trips with a counter that is exported and echoed back by
+  /// the peer. The interface sets `sequence` to a new value before each
+  /// export and measures the time until this value arrives in `echo`. Both
+  /// attributes have to be added as export and import as well.
+  void setRoundTripProbe(CPS::Attribute<Int>::Ptr sequence,
+                         CPS::Attribute<Int>::Ptr echo);
+
+  /// Consume blocking imports `steps` exchanges later than in lockstep, so
+  /// that the simulation keeps stepping while the values of the last steps
+  /// are still in flight. The imports of a step then stem from `steps`
+  /// exchanges earlier than without a delay, which the optional
+  /// extrapolation compensates for. Like the delay of a decoupling line,
+  /// this has to be taken into account when interpreting the results.
+  void setImportDelay(
+      UInt steps,
+      ImportExtrapolation extrapolation = ImportExtrapolation::Hold);
+  /// Predictor for ImportExtrapolation::Custom
+  void setImportPredictor(InterfaceFramePredictor::Function predictor);
+  /// Additional delay of the imports in exchanges, see setImportDelay
+  UInt getImportDelay() const { return mImportDelay; }
+
+  /// Latencies and overruns measured since the interface was opened
+  const InterfaceStatistics &getStatistics() const { return mStatistics; }
+
 protected:
   CPS::Logger::Log mLog;
   String mName;
@@ -61,5 +87,35 @@ protected:
   UInt mCurrentSequenceDpsimToInterface = 1;
   UInt mNextSequenceInterfaceToDpsim = 1;
   std::atomic<bool> mOpened;
+
+  InterfaceStatistics mStatistics;
+  CPS::Attribute<Int>::Ptr mProbeSequence;
+  CPS::Attribute<Int>::Ptr mProbeEcho;
+  /// Send times of the last probe values, indexed by value
+  std::array<std::pair<Int, uint64_t>, 256> mProbeSendTimes;
+  Int mProbeCounter = 0;
+  Int mLastProbeEcho = 0;
+
+  UInt mImportDelay = 0;
+  ImportExtrapolation mImportExtrapolation = ImportExtrapolation::Hold;
+  InterfaceFramePredictor::Function mImportPredictorFunction;
+  InterfaceFramePredictor mImportPredictor;
+  /// Exchanges skipped so far to fill the import pipeline
+  UInt mDelayedImports = 0;
+
+  /// Prepare the delayed imports for a new run, called by open()
+  void initImportDelay(const InterfaceFrameLayout &importLayout);
+  /// True if received import frames go through mImportPredictor
+  bool extrapolatesImports() const {
+    return mImportDelay > 0 &&
+           mImportExtrapolation != ImportExtrapolation::Hold;
+  }
+
+  /// Set the probe sequence for the exports of this step, call before the
+  /// exports are read
+  void stampRoundTripProbe();
+  /// Record a round trip if the imports applied in this step echo a new
+  /// probe value
+  void checkRoundTripProbe();
 };
 } // namespace DPsim
@@ -0,0 +1,188 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <dpsim-models/Attribute.h>
+#include <dpsim/Definitions.h>
+
+#include <readerwriterqueue.h>
+
+namespace DPsim {
+
+/// Values of all imported or exported attributes of an interface for one
+/// step, stored as plain numbers instead of boxed attributes.
+struct InterfaceFrame {
+  /// Increasing ID of the step the values belong to
+  UInt sequenceId = 0;
+  /// When the values were produced, see LatencyHistogram::now
+  uint64_t timestamp = 0;
+  /// Flat value storage, see InterfaceFrameLayout
+  std::vector<Real> data;
+  /// Non-zero for every attribute that has a value in this frame
+  std::vector<unsigned char> updated;
+};
+
+/// Position of each attribute value in an InterfaceFrame.
+///
+/// Int and Bool values are stored as one Real, complex values as real and
+/// imaginary part and matrices column-major with the size they have when the
+/// layout is created. The layout is fixed once the interface is opened.
+class InterfaceFrameLayout {
+public:
+  enum class ValueType { Real, Int, Bool, Complex, Matrix, MatrixComp };
+
+  struct Slot {
+    ValueType type;
+    /// Index of the first value in InterfaceFrame::data
+    UInt offset;
+    /// Matrix size, 1x1 for scalars
+    UInt rows;
+    UInt cols;
+  };
+
+  /// Append a slot for the current value type and size of `attr`.
+  /// Throws for value types that cannot be stored in a frame.
+  void addAttribute(CPS::AttributeBase &attr);
+
+  const std::vector<Slot> &slots() const { return mSlots; }
+  UInt numAttributes() const { return static_cast<UInt>(mSlots.size()); }
+  /// Number of Reals in a frame
+  UInt frameSize() const { return mFrameSize; }
+  /// Number of Reals taken by attribute `index`
+  UInt slotSize(UInt index) const {
+    return (index + 1 < mSlots.size() ? mSlots[index + 1].offset
+                                      : mFrameSize) -
+           mSlots[index].offset;
+  }
+
+  /// Allocate a frame with room for all slots
+  InterfaceFrame makeFrame() const;
+
+  /// Values of attribute `index` within `frame`
+  Real *values(InterfaceFrame &frame, UInt index) const {
+    return frame.data.data() + mSlots[index].offset;
+  }
+  const Real *values(const InterfaceFrame &frame, UInt index) const {
+    return frame.data.data() + mSlots[index].offset;
+  }
+
+  /// Copy the value of `attr` into slot `index` of the frame values `data`.
+  /// `attr` must be the attribute the slot was created for.
+  void pack(UInt index, CPS::AttributeBase &attr, Real *data) const;
+  void pack(UInt index, CPS::AttributeBase &attr, InterfaceFrame &frame) const {
+    pack(index, attr, frame.data.data());
+  }
+  /// Copy slot `index` of the frame values `data` onto `attr`. Returns false
+  /// if the size of a matrix attribute no longer matches the slot.
+  bool unpack(UInt index, const Real *data, CPS::AttributeBase &attr) const;
+  bool unpack(UInt index, const InterfaceFrame &frame,
+              CPS::AttributeBase &attr) const {
+    return unpack(index, frame.data.data(), attr);
+  }
+
+  /// Hash of the slot types and sizes, equal for matching layouts
+  UInt signature() const;
+
+private:
+  std::vector<Slot> mSlots;
+  UInt mFrameSize = 0;
+};
+
+/// Fixed set of frames passed from one producer to one consumer thread.
+///
+/// Filled and consumed frames travel through two queues of frame indices, so
+/// no memory is allocated once the ring is constructed.
+class InterfaceFrameRing {
+public:
+  using Ptr = std::shared_ptr<InterfaceFrameRing>;
+
+  InterfaceFrameRing(UInt numFrames, const InterfaceFrameLayout &layout);
+
+  /// Unused frame for the producer to fill, nullptr if all frames are in use
+  InterfaceFrame *acquire();
+  /// Pass a filled frame to the consumer
+  void publish(InterfaceFrame *frame);
+  /// Wake up the consumer, which receives nullptr after the pending frames
+  void close();
+
+  /// Next filled frame, blocks until one is available.
+  /// Returns nullptr once the ring has been closed.
+  InterfaceFrame *waitPop();
+  /// Next filled frame or nullptr if none is pending
+  InterfaceFrame *tryPop();
+  /// Return a consumed frame to the producer
+  void release(InterfaceFrame *frame);
+  /// True once the consumer has seen the close marker
+  bool isClosed() const { return mClosed; }
+
+private:
+  std::vector<InterfaceFrame> mFrames;
+  moodycamel::BlockingReaderWriterQueue<UInt> mFilled;
+  moodycamel::BlockingReaderWriterQueue<UInt> mFree;
+  /// Only accessed by the consumer
+  bool mClosed = false;
+
+  InterfaceFrame *frameFromIndex(UInt index);
+};
+
+/// How imports that are consumed with a delay are predicted for the current
+/// step, see Interface::setImportDelay
+enum class ImportExtrapolation {
+  /// Apply the last received values unchanged
+  Hold,
+  /// Extrapolate linearly from the last two received frames
+  Linear,
+  /// Call the function set with Interface::setImportPredictor
+  Custom
+};
+
+/// Extrapolates the values of the last received import frames by a number
+/// of steps. Int and Bool values are never extrapolated.
+class InterfaceFramePredictor {
+public:
+  /// Writes the prediction for `steps` steps after `newest` into
+  /// `prediction`. `previous` holds the frame received before `newest`.
+  using Function = std::function<void(
+      const InterfaceFrameLayout &layout, const std::vector<Real> &newest,
+      const std::vector<Real> &previous, UInt steps,
+      std::vector<Real> &prediction)>;
+
+  void configure(const InterfaceFrameLayout &layout, ImportExtrapolation mode,
+                 UInt steps, Function function = nullptr);
+
+  /// Add a received frame to the history. Only the updated values are
+  /// taken over, the others keep their last received value.
+  void push(const Real *values, const unsigned char *updated = nullptr);
+  void push(const InterfaceFrame &frame) {
+    push(frame.data.data(), frame.updated.data());
+    mPrediction.sequenceId = frame.sequenceId;
+    mPrediction.timestamp = frame.timestamp;
+  }
+  /// Values predicted from the frames pushed so far. All attributes that
+  /// have been received at least once are marked as updated.
+  const InterfaceFrame &predict();
+
+  UInt numReceived() const { return mNumReceived; }
+
+private:
+  InterfaceFrameLayout mLayout;
+  ImportExtrapolation mMode = ImportExtrapolation::Hold;
+  UInt mSteps = 0;
+  Function mFunction;
+
+  std::vector<Real> mNewest;
+  std::vector<Real> mPrevious;
+  InterfaceFrame mPrediction;
+  UInt mNumReceived = 0;
+};
+} // namespace DPsim
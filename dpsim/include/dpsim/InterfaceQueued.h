@@ -13,10 +13,9 @@
 #include <dpsim/Config.h>
 #include <dpsim/Definitions.h>
 #include <dpsim/Interface.h>
+#include <dpsim/InterfaceFrame.h>
 #include <dpsim/Scheduler.h>
 
-#include <readerwriterqueue.h>
-
 namespace DPsim {
 
 class InterfaceWorker;
@@ -27,28 +26,13 @@ class InterfaceQueued : public Interface,
 public:
   typedef std::shared_ptr<InterfaceQueued> Ptr;
 
-  using AttributePacket = struct AttributePacket {
-    CPS::AttributeBase::Ptr value;
-    UInt
-        attributeId; // Used to identify the attribute. Defined by the position in the `mExportAttrsDpsim` and `mImportAttrsDpsim` lists
-    UInt
-        sequenceId; // Increasing ID used to discern multiple consecutive updates of a single attribute
-    unsigned char flags; // Bit 0 set: Close interface
-  };
-
-  enum AttributePacketFlags {
-    PACKET_NO_FLAGS = 0,
-    PACKET_CLOSE_INTERFACE = 1,
-  };
-
+  /// `numFrames` is the number of steps that can be buffered in each
+  /// direction before values are dropped
   InterfaceQueued(std::shared_ptr<InterfaceWorker> intf,
-                  const String &name = "", UInt downsampling = 1)
-      : Interface(name), mInterfaceWorker(intf), mDownsampling(downsampling) {
-    mQueueDpsimToInterface = std::make_shared<
-        moodycamel::BlockingReaderWriterQueue<AttributePacket>>();
-    mQueueInterfaceToDpsim = std::make_shared<
-        moodycamel::BlockingReaderWriterQueue<AttributePacket>>();
-  };
+                  const String &name = "", UInt downsampling = 1,
+                  UInt numFrames = 64)
+      : Interface(name), mInterfaceWorker(intf), mDownsampling(downsampling),
+        mNumFrames(numFrames){};
 
   virtual void open() override;
   virtual void close() override;
@@ -80,42 +64,55 @@ protected:
   std::thread mInterfaceWriterThread;
   std::thread mInterfaceReaderThread;
 
-  std::shared_ptr<moodycamel::BlockingReaderWriterQueue<AttributePacket>>
-      mQueueDpsimToInterface;
-  std::shared_ptr<moodycamel::BlockingReaderWriterQueue<AttributePacket>>
-      mQueueInterfaceToDpsim;
+  UInt mNumFrames;
+
+  /// Position of the attribute values in the frames, fixed by open()
+  InterfaceFrameLayout mImportLayout;
+  InterfaceFrameLayout mExportLayout;
+  /// One frame per step, shared with the interface threads
+  InterfaceFrameRing::Ptr mRingDpsimToInterface;
+  InterfaceFrameRing::Ptr mRingInterfaceToDpsim;
+
+  /// Apply the values of a received frame to the imported attributes
+  void applyImportFrame(const InterfaceFrame &frame);
+  /// Consume one frame per step after the pipeline of delayed imports has
+  /// been filled, see setImportDelay
+  void popDelayedImports();
 
 public:
   class WriterThread {
   private:
-    std::shared_ptr<moodycamel::BlockingReaderWriterQueue<AttributePacket>>
-        mQueueDpsimToInterface;
+    InterfaceFrameRing::Ptr mRingDpsimToInterface;
     std::shared_ptr<InterfaceWorker> mInterfaceWorker;
+    InterfaceStatistics &mStatistics;
 
   public:
-    WriterThread(
-        std::shared_ptr<moodycamel::BlockingReaderWriterQueue<AttributePacket>>
-            queueDpsimToInterface,
-        std::shared_ptr<InterfaceWorker> intf)
-        : mQueueDpsimToInterface(queueDpsimToInterface),
-          mInterfaceWorker(intf){};
+    WriterThread(InterfaceFrameRing::Ptr ringDpsimToInterface,
+                 std::shared_ptr<InterfaceWorker> intf,
+                 InterfaceStatistics &statistics)
+        : mRingDpsimToInterface(ringDpsimToInterface), mInterfaceWorker(intf),
+          mStatistics(statistics){};
     void operator()() const;
   };
 
   class ReaderThread {
   private:
-    std::shared_ptr<moodycamel::BlockingReaderWriterQueue<AttributePacket>>
-        mQueueInterfaceToDpsim;
+    InterfaceFrameRing::Ptr mRingInterfaceToDpsim;
+    InterfaceFrameLayout mLayout;
     std::shared_ptr<InterfaceWorker> mInterfaceWorker;
     std::atomic<bool> &mOpened;
+    InterfaceStatistics &mStatistics;
+    CPS::Logger::Log mLog;
 
   public:
-    ReaderThread(
-        std::shared_ptr<moodycamel::BlockingReaderWriterQueue<AttributePacket>>
-            queueInterfaceToDpsim,
-        std::shared_ptr<InterfaceWorker> intf, std::atomic<bool> &opened)
-        : mQueueInterfaceToDpsim(queueInterfaceToDpsim), mInterfaceWorker(intf),
-          mOpened(opened){};
+    ReaderThread(InterfaceFrameRing::Ptr ringInterfaceToDpsim,
+                 const InterfaceFrameLayout &layout,
+                 std::shared_ptr<InterfaceWorker> intf,
+                 std::atomic<bool> &opened, InterfaceStatistics &statistics,
+                 CPS::Logger::Log log)
+        : mRingInterfaceToDpsim(ringInterfaceToDpsim), mLayout(layout),
+          mInterfaceWorker(intf), mOpened(opened), mStatistics(statistics),
+          mLog(log){};
     void operator()() const;
   };
 
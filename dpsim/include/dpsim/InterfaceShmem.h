@@ -0,0 +1,137 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <dpsim/Interface.h>
+#include <dpsim/InterfaceFrame.h>
+
+namespace DPsim {
+
+/// Interface exchanging attribute values with another process on the same
+/// host through POSIX shared memory, without VILLASnode.
+///
+/// Each direction is a lock-free single-producer/single-consumer ring of
+/// cache-line-aligned frames in its own shared memory object. A frame holds
+/// the values of all exported attributes of one step in the layout of
+/// InterfaceFrameLayout, together with the step's sequence number. The
+/// process creates the ring for its exports and opens the ring of its peer
+/// for the imports, so two peers are configured with swapped names.
+/// Values are exchanged directly in the simulation tasks, there is no
+/// interface thread.
+class InterfaceShmem : public Interface {
+public:
+  typedef std::shared_ptr<InterfaceShmem> Ptr;
+
+  /// How the reader waits for the next frame
+  enum class WaitMode {
+    /// Poll the ring position without sleeping, lowest latency but
+    /// occupies a core
+    BusyPoll,
+    /// Spin briefly, then sleep on a futex that the writer wakes up
+    Futex
+  };
+
+  /// @param exportName Name of the shared memory object created for exports
+  /// @param importName Name of the shared memory object created by the peer
+  /// @param numFrames Number of frames in the export ring
+  InterfaceShmem(const String &exportName, const String &importName,
+                 const String &name = "", UInt numFrames = 64,
+                 WaitMode waitMode = WaitMode::Futex,
+                 spdlog::level::level_enum logLevel =
+                     spdlog::level::level_enum::info);
+
+  virtual ~InterfaceShmem();
+
+  /// Maximum time open() waits for the peer to create its ring
+  void setOpenTimeout(Real seconds) { mOpenTimeout = seconds; }
+
+  virtual void open() override;
+  virtual void close() override;
+
+  // Function called by the Simulation to perform interface synchronization
+  virtual void syncExports() override;
+  // Function called by the Simulation to perform interface synchronization
+  virtual void syncImports() override;
+
+  virtual CPS::Task::List getTasks() override;
+
+  /// Write the current values of all exports as a new frame
+  void writeExports();
+  /// Apply a frame of the peer. With `block` set, wait for the next frame
+  /// and apply the frames in order, one per call, which keeps two peers in
+  /// lockstep. Otherwise apply the latest frame, if any. Returns false if
+  /// the peer has closed its ring meanwhile.
+  bool readImports(bool block);
+
+protected:
+  struct Ring;
+
+  String mExportName;
+  String mImportName;
+  UInt mNumFrames;
+  WaitMode mWaitMode;
+  Real mOpenTimeout = 10;
+
+  InterfaceFrameLayout mImportLayout;
+  InterfaceFrameLayout mExportLayout;
+
+  /// Mapped rings and their sizes
+  Ring *mExportRing = nullptr;
+  Ring *mImportRing = nullptr;
+  size_t mExportRingBytes = 0;
+  size_t mImportRingBytes = 0;
+
+  /// True if any import blocks the step until a new value arrives
+  bool mBlockOnRead = false;
+  UInt mSequenceDpsimToPeer = 1;
+  /// Sequence number of the last frame read from the peer
+  UInt mLastImportSequence = 0;
+  UInt mDroppedFrames = 0;
+
+  Ring *createRing(const String &shmName, const InterfaceFrameLayout &layout,
+                   size_t &bytes);
+  Ring *openRing(const String &shmName, const InterfaceFrameLayout &layout,
+                 size_t &bytes);
+  /// Wait until the import ring holds a frame not read yet
+  bool waitForFrame();
+
+public:
+  class PreStep : public CPS::Task {
+  public:
+    explicit PreStep(InterfaceShmem &intf)
+        : Task(intf.mName + ".Read"), mIntf(intf) {
+      for (const auto &[attr, _seqId, _blockOnRead, _syncOnStart] :
+           intf.mImportAttrsDpsim) {
+        mModifiedAttributes.push_back(attr);
+      }
+    }
+
+    void execute(Real time, Int timeStepCount) override;
+
+  private:
+    InterfaceShmem &mIntf;
+  };
+
+  class PostStep : public CPS::Task {
+  public:
+    explicit PostStep(InterfaceShmem &intf)
+        : Task(intf.mName + ".Write"), mIntf(intf) {
+      for (const auto &[attr, _seqId] : intf.mExportAttrsDpsim) {
+        mAttributeDependencies.push_back(attr);
+      }
+      mModifiedAttributes.push_back(Scheduler::external);
+    }
+
+    void execute(Real time, Int timeStepCount) override;
+
+  private:
+    InterfaceShmem &mIntf;
+  };
+};
+} // namespace DPsim
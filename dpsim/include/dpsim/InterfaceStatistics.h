@@ -0,0 +1,44 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <atomic>
+
+#include <dpsim-models/Logger.h>
+#include <dpsim/Definitions.h>
+#include <dpsim/LatencyHistogram.h>
+
+namespace DPsim {
+
+/// Latencies and overruns of an interface, recorded while the simulation
+/// runs. Which of them are measured depends on the interface type.
+struct InterfaceStatistics {
+  /// From the end of a step until its exports are handed to the transport
+  LatencyHistogram exportHandoff;
+  /// From the end of a step until the interface thread dequeues its exports
+  LatencyHistogram exportDequeue;
+  /// From the reception of imports until they are applied to the attributes
+  LatencyHistogram importApply;
+  /// From sending a sequence number until the peer echoes it back, see
+  /// Interface::setRoundTripProbe
+  LatencyHistogram roundTrip;
+
+  /// Steps which received more than one set of imports
+  std::atomic<uint64_t> importOverruns{0};
+  /// Exports dropped because the transport did not keep up
+  std::atomic<uint64_t> droppedExports{0};
+  /// Imports dropped because the simulation did not keep up
+  std::atomic<uint64_t> droppedImports{0};
+
+  void reset();
+  /// Write all histograms that recorded something and the overrun counts
+  void log(CPS::Logger::Log log, const String &name) const;
+};
+
+} // namespace DPsim
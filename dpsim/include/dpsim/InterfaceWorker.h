@@ -10,6 +10,7 @@
 #include <dpsim/Config.h>
 #include <dpsim/Definitions.h>
 #include <dpsim/Interface.h>
+#include <dpsim/InterfaceFrame.h>
 #include <dpsim/InterfaceQueued.h>
 #include <dpsim/Scheduler.h>
 
@@ -19,7 +20,10 @@ class InterfaceWorker {
 
 protected:
   bool mOpened;
-  UInt mCurrentSequenceInterfaceToDpsim = 1;
+
+  /// Position of the attribute values in the frames, set before `open`
+  InterfaceFrameLayout mImportLayout;
+  InterfaceFrameLayout mExportLayout;
 
 public:
   using Ptr = std::shared_ptr<InterfaceWorker>;
@@ -31,20 +35,30 @@ public:
 
   /**
    * Function that will be called on loop in its separate thread.
-   * Should be used to read values from the environment and push them into `updatedAttrs`
-   * `updatedAttrs` will always be empty when this function is invoked
+   * Should be used to read values from the environment and store them in `frame`
+   * at the positions given by `mImportLayout`, marking each of them in `frame.updated`.
+   * `frame.updated` will always be cleared when this function is invoked
+   * Returns true if at least one value was read
    */
-  virtual void readValuesFromEnv(
-      std::vector<InterfaceQueued::AttributePacket> &updatedAttrs) = 0;
+  virtual bool readValuesFromEnv(InterfaceFrame &frame) = 0;
 
   /**
    * Function that will be called on loop in its separate thread.
-   * Should be used to read values from `updatedAttrs` and write them to the environment
-   * The `updatedAttrs` list will not be cleared by the caller in between function calls
-   * When this function is called, `updatedAttrs` will include at least one value.
+   * Should be used to write the values in `frame` to the environment
+   * The frame holds the values of all exported attributes of one step at the positions given by `mExportLayout`.
+   * If several steps are pending, only the latest one is passed.
+   */
+  virtual void writeValuesToEnv(const InterfaceFrame &frame) = 0;
+
+  /**
+   * Set the frame layouts of imported and exported attributes
+   * This is called by the interface right before `open`
    */
-  virtual void writeValuesToEnv(
-      std::vector<InterfaceQueued::AttributePacket> &updatedAttrs) = 0;
+  void setFrameLayouts(const InterfaceFrameLayout &importLayout,
+                       const InterfaceFrameLayout &exportLayout) {
+    mImportLayout = importLayout;
+    mExportLayout = exportLayout;
+  }
 
   /**
    * Open the interface and set up the connection to the environment
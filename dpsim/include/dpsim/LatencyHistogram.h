@@ -0,0 +1,71 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include <dpsim/Definitions.h>
+
+namespace DPsim {
+
+/// Histogram of durations in nanoseconds with a fixed number of buckets, so
+/// that recording neither allocates nor locks. The buckets are logarithmic
+/// with four buckets per power of two, which bounds the relative error of a
+/// quantile to 25%. Durations beyond about half an hour end up in the last
+/// bucket. One thread may record while others read.
+class LatencyHistogram {
+public:
+  static constexpr UInt subBuckets = 4;
+  static constexpr UInt numBuckets = 160;
+
+  /// Monotonic time in nanoseconds, comparable between processes on the
+  /// same host
+  static uint64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+  void record(uint64_t nanoseconds);
+  /// Record the time passed since `start`, taken from now()
+  void recordSince(uint64_t start) {
+    uint64_t end = now();
+    record(end > start ? end - start : 0);
+  }
+  void reset();
+
+  uint64_t count() const { return mCount.load(std::memory_order_relaxed); }
+  uint64_t min() const;
+  uint64_t max() const { return mMax.load(std::memory_order_relaxed); }
+  Real mean() const;
+  /// Upper bound of the bucket holding the quantile `q` in [0, 1]
+  uint64_t quantile(Real q) const;
+
+  uint64_t bucketCount(UInt bucket) const {
+    return mBuckets[bucket].load(std::memory_order_relaxed);
+  }
+  /// Smallest duration that falls into `bucket`
+  static uint64_t bucketLowerBound(UInt bucket);
+  static UInt bucketIndex(uint64_t nanoseconds);
+
+  /// One line with count, mean, median, 99th percentile and maximum
+  String summary() const;
+
+private:
+  std::array<std::atomic<uint64_t>, numBuckets> mBuckets{};
+  std::atomic<uint64_t> mCount{0};
+  std::atomic<uint64_t> mSum{0};
+  std::atomic<uint64_t> mMin{UINT64_MAX};
+  std::atomic<uint64_t> mMax{0};
+};
+
+} // namespace DPsim
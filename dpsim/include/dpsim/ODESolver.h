@@ -47,6 +47,18 @@ protected:
   /// Constant time step
   Real mTimestep;
 
+  /// End time of the last step, the integrator continues from there
+  Real mLastTime{0};
+  /// Largest deviation from mLastTime, relative to the time step, which
+  /// still counts as a continuous step
+  static constexpr Real TIME_TOLERANCE = 1e-6;
+  /// State returned by the last step
+  CPS::Matrix mLastState;
+  /// True after the integrator has been initialized with a start value
+  bool mIntegratorStarted{false};
+  /// Number of reinitializations caused by discontinuous states or times
+  long int mNumReinits{0};
+
   // Same tolerance for each component regardless of system characteristics
   /// Relative tolerance
   realtype reltol = RCONST(1.0e-6);
@@ -73,6 +85,11 @@ protected:
   /// ARKode- standard error detection function; in DAE-solver not detection function is used -> for efficiency purposes?
   int check_flag(void *flagvalue, const std::string &funcname, int opt);
 
+  /// Create the integrator memory, matrix and linear solver once
+  void createIntegrator(Real initial_time);
+  /// Restart the integration at a discontinuity, keeping all allocations
+  void reinitialize(Real initial_time);
+
 public:
   /// Create solve object with corresponding component and information on the integration type
   ODESolver(String name, const CPS::ODEInterface::Ptr &comp,
@@ -102,5 +119,7 @@ public:
   void initialize();
   /// Solve system for the current time
   Real step(Real initial_time);
+  /// Number of restarts because the state or time jumped between steps
+  long int numReinits() const { return mNumReinits; }
 };
 } // namespace DPsim
@@ -0,0 +1,103 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <dpsim/PFSolverPowerPolar.h>
+
+namespace DPsim {
+/// N-1 branch outage screening based on the Newton-Raphson powerflow.
+///
+/// After the base case is solved, every line and transformer is taken out of
+/// service one at a time. The outage is applied as a rank-two update of the
+/// admittance matrix entries of the two branch nodes, which keeps the
+/// sparsity pattern and therefore the symbolic analysis of the Jacobian.
+/// Each case starts from the base case solution. Cases are distributed over
+/// worker threads, each with its own copy of the solver state.
+class PFContingencyAnalysis : public PFSolverPowerPolar {
+public:
+  /// Outcome of a single branch outage
+  struct Result {
+    /// Name of the branch taken out of service
+    CPS::String branch;
+    /// True if the outage separates buses from all slack buses
+    CPS::Bool islanded = false;
+    CPS::Bool converged = false;
+    CPS::UInt iterations = 0;
+    /// Voltage extremes over all buses [pu]
+    CPS::Real minVoltage = 0;
+    CPS::Real maxVoltage = 0;
+    /// Buses outside the voltage band and branches above their limit
+    std::vector<CPS::String> violations;
+    /// Wall clock time of the case [s]
+    CPS::Real solveTime = 0;
+  };
+
+protected:
+  /// Branch with its nodes and admittance stamp in per-unit
+  struct Branch {
+    CPS::String name;
+    CPS::UInt from;
+    CPS::UInt to;
+    CPS::MatrixComp y;
+    /// Apparent power limit [pu], zero for no limit
+    CPS::Real limit;
+  };
+  std::vector<Branch> mBranches;
+
+  /// Apparent power limits of branches by name [VA]
+  std::map<CPS::String, CPS::Real> mBranchLimits;
+  /// Allowed voltage band [pu]
+  CPS::Real mMinVoltage = 0.9;
+  CPS::Real mMaxVoltage = 1.1;
+  /// Number of worker threads, zero uses the hardware concurrency
+  CPS::UInt mNumThreads = 0;
+
+  /// Base case solution used as starting point for all outages
+  CPS::Vector mBaseV;
+  CPS::Vector mBaseD;
+
+  /// Collect the branches and their admittance stamps
+  void collectBranches();
+  /// Copy the specified injections and base solution of another instance
+  void copyBaseCase(const PFContingencyAnalysis &base);
+  /// Check whether all buses are still connected to a slack bus
+  CPS::Bool isConnected();
+  /// Solve the outage of the branch with the given index
+  void evaluate(CPS::UInt outage, Result &result);
+  /// Check voltages and flows of the remaining branches
+  void checkLimits(CPS::UInt outage, Result &result);
+
+public:
+  /// Constructor to be used in simulation examples.
+  PFContingencyAnalysis(CPS::String name, const CPS::SystemTopology &system,
+                        CPS::Real timeStep, CPS::Logger::Level logLevel);
+  ///
+  virtual ~PFContingencyAnalysis(){};
+
+  /// Initialization of the solver, needed before run()
+  using PFSolver::initialize;
+
+  /// Set the allowed voltage band [pu]
+  void setVoltageLimits(CPS::Real minVoltage, CPS::Real maxVoltage) {
+    mMinVoltage = minVoltage;
+    mMaxVoltage = maxVoltage;
+  }
+  /// Set the apparent power limit of a line or transformer [VA]
+  void setBranchLimit(const CPS::String &name, CPS::Real apparentPower) {
+    mBranchLimits[name] = apparentPower;
+  }
+  /// Set the number of worker threads, zero uses the hardware concurrency
+  void setNumThreads(CPS::UInt numThreads) { mNumThreads = numThreads; }
+
+  /// Solve the base case and all single branch outages. The results are in
+  /// the order of the lines followed by the transformers. Throws if the base
+  /// case does not converge.
+  std::vector<Result> run();
+};
+} // namespace DPsim
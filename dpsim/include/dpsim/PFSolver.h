@@ -46,8 +46,12 @@ protected:
   /// Admittance matrix
   CPS::SparseMatrixCompRow mY;
 
-  /// Jacobian matrix
-  CPS::Matrix mJ;
+  /// Jacobian matrix, its sparsity pattern is fixed after initialization
+  CPS::SparseMatrix mJ;
+  /// LU factorization of the Jacobian
+  CPS::LUFactorizedSparse mJLU;
+  /// Flag whether the symbolic analysis of mJ is done
+  CPS::Bool mJacobianAnalyzed = false;
   /// Solution vector
   CPS::Vector mX;
   /// Vector of mismatch values
@@ -97,6 +101,8 @@ protected:
                                        bool keep_last_solution = false) = 0;
   /// Calculate mismatch
   virtual void calculateMismatch() = 0;
+  /// Set up the sparsity pattern of the Jacobian
+  virtual void initializeJacobianPattern() {}
   /// Calculate the Jacobian
   virtual void calculateJacobian() = 0;
   /// Update solution in each iteration
@@ -119,12 +125,17 @@ protected:
 
   /// Compose admittance matrix
   void composeAdmittanceMatrix();
+  /// Whether the transformer is stamped into the admittance matrix. Ideal
+  /// transformers without impedance are ignored.
+  static Bool isAdmittanceStamped(const CPS::SP::Ph1::Transformer &trafo) {
+    return **trafo.mResistance != 0 || **trafo.mInductance != 0;
+  }
   /// Gets the real part of admittance matrix element
   CPS::Real G(int i, int j);
   /// Gets the imaginary part of admittance matrix element
   CPS::Real B(int i, int j);
   /// Solves the powerflow problem
-  Bool solvePowerflow();
+  virtual Bool solvePowerflow();
   /// Check whether below tolerance
   CPS::Bool checkConvergence();
   /// Logging for integer vectors
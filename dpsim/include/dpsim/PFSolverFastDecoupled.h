@@ -0,0 +1,48 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <dpsim/PFSolverPowerPolar.h>
+
+namespace DPsim {
+/// Fast decoupled powerflow solver (XB version).
+///
+/// The constant matrices B' and B'' are built from the admittance matrix and
+/// factorized once during initialization. Each iteration consists of a
+/// P-theta and a Q-V half step which only need forward and back
+/// substitutions. B' neglects the series resistances and shunts, B'' is the
+/// negative susceptance matrix of the PQ buses.
+class PFSolverFastDecoupled : public PFSolverPowerPolar {
+protected:
+  /// Matrix B' for the P-theta half step over PQ and PV buses
+  CPS::SparseMatrix mBPrime;
+  /// Matrix B'' for the Q-V half step over PQ buses
+  CPS::SparseMatrix mBDoublePrime;
+  CPS::LUFactorizedSparse mBPrimeLU;
+  CPS::LUFactorizedSparse mBDoublePrimeLU;
+  /// Scaled active power mismatch and angle increments
+  CPS::Vector mDeltaP;
+  CPS::Vector mDeltaTheta;
+  /// Scaled reactive power mismatch and voltage increments
+  CPS::Vector mDeltaQ;
+  CPS::Vector mDeltaV;
+
+  /// Build and factorize B' and B''
+  void initializeJacobianPattern() override;
+  /// Solves the powerflow problem with decoupled half steps
+  Bool solvePowerflow() override;
+
+public:
+  /// Constructor to be used in simulation examples.
+  PFSolverFastDecoupled(CPS::String name, const CPS::SystemTopology &system,
+                        CPS::Real timeStep, CPS::Logger::Level logLevel);
+  ///
+  virtual ~PFSolverFastDecoupled(){};
+};
+} // namespace DPsim
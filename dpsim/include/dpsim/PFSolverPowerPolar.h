@@ -30,17 +30,36 @@ protected:
   CPS::Vector Pesp;
   CPS::Vector Qesp;
 
+  /// Admittance matrix entry between two PQ or PV buses together with the
+  /// positions of the Jacobian values it contributes to
+  struct JacobianEntry {
+    CPS::UInt k;
+    CPS::UInt j;
+    /// Position in the values of mY, -1 for a zero entry
+    CPS::Int y;
+    /// Positions in the values of mJ for the four sub-matrices, -1 if the
+    /// entry does not contribute to the sub-matrix
+    CPS::Int j1, j2, j3, j4;
+  };
+  /// Entries on the diagonals of the sub-matrices
+  std::vector<JacobianEntry> mJacobianDiagonal;
+  /// Entries off the diagonals, only where buses are connected
+  std::vector<JacobianEntry> mJacobianOffDiagonal;
+
   // Core methods
   /// Generate initial solution for current time step
-  void generateInitialSolution(Real time, bool keep_last_solution = false);
+  void generateInitialSolution(Real time,
+                               bool keep_last_solution = false) override;
+  /// Set up the Jacobian pattern from the nonzeros of the admittance matrix
+  void initializeJacobianPattern() override;
   /// Calculate the Jacobian
-  void calculateJacobian();
+  void calculateJacobian() override;
   /// Update solution in each iteration
-  void updateSolution();
+  void updateSolution() override;
   /// Set final solution
-  void setSolution();
+  void setSolution() override;
   /// Calculate mismatch
-  void calculateMismatch();
+  void calculateMismatch() override;
 
   // Helper methods
   /// Resize solution vector
@@ -57,6 +76,8 @@ protected:
   CPS::Real P(CPS::UInt k);
   /// Calculate the reactive power at a bus from current solution
   CPS::Real Q(CPS::UInt k);
+  /// Calculate the current injected into the network at a bus
+  CPS::Complex injectedCurrent(CPS::UInt k);
   /// Calculate P and Q at slack bus from current solution
   void calculatePAndQAtSlackBus();
   /// Calculate the reactive power at all PV buses from current solution
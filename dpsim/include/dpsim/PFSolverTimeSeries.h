@@ -0,0 +1,97 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <dpsim/PFSolverPowerPolar.h>
+
+namespace DPsim {
+/// Quasi-static time-series (QSTS) powerflow.
+///
+/// The specified injections are assembled once. For every further time point
+/// only the per-unit powers of loads with a profile are updated and scattered
+/// into the injection vectors. Newton starts from the solution of the
+/// previous time point and keeps the factorized Jacobian as long as it still
+/// reduces the mismatch by at least the reuse contraction factor per
+/// iteration. Other set-points are assumed to stay constant.
+///
+/// solveTimeSeries() runs all time points without going through the
+/// scheduler and stores the voltages in columns, one contiguous column per
+/// node. The solver can also be scheduled like PFSolverPowerPolar.
+class PFSolverTimeSeries : public PFSolverPowerPolar {
+protected:
+  /// Loads with a profile and the index of the node they are connected to
+  std::vector<std::shared_ptr<CPS::SP::Ph1::Load>> mProfileLoads;
+  std::vector<CPS::UInt> mProfileLoadNodes;
+  /// Per-unit powers of the profile loads at the current time point
+  CPS::Vector mProfileP;
+  CPS::Vector mProfileQ;
+  /// Specified injections without the contribution of the profile loads
+  CPS::Vector mPespBase;
+  CPS::Vector mQespBase;
+  /// Flag whether the constant injections have been assembled
+  CPS::Bool mInjectionsInitialized = false;
+
+  /// Flag whether mJLU holds a usable factorization
+  CPS::Bool mFactorizationValid = false;
+  /// Required ratio between successive mismatch norms to keep the Jacobian
+  CPS::Real mReuseContraction = 0.25;
+  /// Number of numeric factorizations of the Jacobian
+  CPS::UInt mNumFactorizations = 0;
+
+  /// Time points of the stored results
+  CPS::Vector mResultTimes;
+  /// Voltage magnitudes [pu] and angles [rad], one column per node
+  CPS::Matrix mResultVoltageMagnitudes;
+  CPS::Matrix mResultVoltageAngles;
+  /// Newton iterations per time point, -1 if not converged
+  std::vector<CPS::Int> mResultIterations;
+
+  /// Assemble the injections on the first call, afterwards only update the
+  /// profile loads and keep the previous solution as starting point
+  void generateInitialSolution(Real time,
+                               bool keep_last_solution = false) override;
+  /// Newton iterations reusing the factorized Jacobian
+  Bool solvePowerflow() override;
+  /// Update the per-unit powers of the profile loads for a time point
+  void updateProfileLoads(Real time);
+
+public:
+  /// Constructor to be used in simulation examples.
+  PFSolverTimeSeries(CPS::String name, const CPS::SystemTopology &system,
+                     CPS::Real timeStep, CPS::Logger::Level logLevel);
+  ///
+  virtual ~PFSolverTimeSeries(){};
+
+  /// Initialization of the solver, needed before solveTimeSeries()
+  using PFSolver::initialize;
+
+  /// Set the ratio between successive mismatch norms above which the
+  /// Jacobian is recomputed. Zero recomputes it in every iteration.
+  void setReuseContraction(CPS::Real contraction) {
+    mReuseContraction = contraction;
+  }
+  /// Solve numSteps time points starting at startTime with the time step of
+  /// the solver. Component states are only updated for the last time point.
+  void solveTimeSeries(CPS::Real startTime, CPS::UInt numSteps);
+  /// Write the stored results as CSV file
+  void writeResults(const CPS::String &filename) const;
+
+  const CPS::Vector &resultTimes() const { return mResultTimes; }
+  const CPS::Matrix &resultVoltageMagnitudes() const {
+    return mResultVoltageMagnitudes;
+  }
+  const CPS::Matrix &resultVoltageAngles() const {
+    return mResultVoltageAngles;
+  }
+  const std::vector<CPS::Int> &resultIterations() const {
+    return mResultIterations;
+  }
+  CPS::UInt numFactorizations() const { return mNumFactorizations; }
+};
+} // namespace DPsim
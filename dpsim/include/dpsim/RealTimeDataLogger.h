@@ -6,11 +6,13 @@
  */
 #pragma once
 
+#include <atomic>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <map>
 #include <system_error>
+#include <thread>
 
 #include <dpsim-models/Attribute.h>
 #include <dpsim-models/PtrFactory.h>
@@ -25,13 +27,43 @@ namespace DPsim {
 class RealTimeDataLogger : public DataLoggerInterface,
                            public SharedFactory<RealTimeDataLogger> {
 
+public:
+  enum class Mode {
+    /// Preallocate one row per time step and write the file in stop()
+    Preallocate,
+    /// Keep a fixed-size ring of rows that a background thread drains to
+    /// the file while the simulation is running
+    Stream
+  };
+
 protected:
   std::filesystem::path mFilename;
+  Mode mMode;
   size_t mRowNumber;
   size_t mCurrentRow;
   size_t mCurrentAttribute;
 
-  std::vector<std::vector<Real>> mAttributeData;
+  std::vector<Column> mColumns;
+  /// Number of values per row including the time column
+  size_t mRowSize;
+  /// Contiguous row-major storage of mRowNumber rows of mRowSize values
+  std::vector<Real> mAttributeData;
+
+  // Streaming mode state. mHead is only written by the simulation thread,
+  // mTail only by the drain thread.
+  std::ofstream mLogFile;
+  std::thread mDrainThread;
+  std::atomic<bool> mDraining;
+  std::atomic<size_t> mHead;
+  std::atomic<size_t> mTail;
+  std::atomic<size_t> mDroppedRows;
+  Real mDrainInterval;
+
+  void openLogFile();
+  void writeHeader();
+  void writeRows(size_t begin, size_t end, String &buffer);
+  void fillRow(Real *row, Real time);
+  void drain();
 
 public:
   typedef std::shared_ptr<RealTimeDataLogger> Ptr;
@@ -39,6 +71,11 @@ public:
   RealTimeDataLogger(std::filesystem::path &filename, Real finalTime,
                      Real timeStep);
   RealTimeDataLogger(std::filesystem::path &filename, size_t rowNumber);
+  /// In streaming mode, rowNumber is the capacity of the ring buffer and
+  /// drainInterval the period in seconds in which the drain thread polls it.
+  RealTimeDataLogger(std::filesystem::path &filename, size_t rowNumber,
+                     Mode mode, Real drainInterval = 0.01);
+  virtual ~RealTimeDataLogger();
 
   virtual void start() override;
   virtual void stop() override;
@@ -47,6 +84,19 @@ public:
 
   virtual CPS::Task::Ptr getTask() override;
 
+  /// Number of rows discarded because the ring buffer was full
+  size_t droppedRows() const { return mDroppedRows.load(); }
+
+  /// Row-major storage of rowNumber() rows of rowSize() values, of which the
+  /// first is the time. It is allocated in start() and stays valid until the
+  /// logger is started again. In streaming mode it is the ring buffer.
+  const std::vector<Real> &data() const { return mAttributeData; }
+  size_t rowNumber() const { return mRowNumber; }
+  size_t rowSize() const { return mRowSize; }
+  Mode mode() const { return mMode; }
+  /// Names of the values in a row, starting with "time"
+  std::vector<String> columnNames() const;
+
   class Step : public CPS::Task {
   public:
     Step(RealTimeDataLogger &logger)
@@ -20,9 +20,42 @@ namespace DPsim {
 /// Extending Simulation class by real-time functionality.
 class RealTimeSimulation : public Simulation {
 
+public:
+  /// Options of the preflight phase between initialization and the first
+  /// timed step
+  struct Preflight {
+    /// Lock all current and future pages of the process into memory
+    bool lockMemory = true;
+    /// Bytes of stack touched to fault it in
+    size_t stackSize = 256 * 1024;
+    /// Untimed steps of the solver tasks. The state of the components and
+    /// nodes is restored afterwards.
+    UInt warmupSteps = 100;
+    /// Largest admissible ratio of worst-case step time to time step
+    Real maxLoad = 0.8;
+    /// Refuse to start if the margin is insufficient instead of warning
+    bool failOnInsufficientMargin = false;
+  };
+
+  /// Thrown if the worst-case step time exceeds the margin of the preflight
+  struct PreflightException {
+    Real worstCaseStepTime;
+  };
+
 protected:
   Timer mTimer;
 
+  bool mPreflightEnabled = false;
+  Preflight mPreflight;
+  Real mWorstCaseStepTime = 0;
+
+  /// Prepare the process and measure the step time before the timed loop
+  void preflight();
+  /// Run the scheduled solver tasks for a number of steps without timer,
+  /// interfaces and loggers, then restore the state. Returns the worst-case
+  /// step time.
+  Real warmup(UInt steps);
+
 public:
   RealTimeSimulation(String name, CommandLineArgs &args);
   /// Standard constructor
@@ -39,5 +72,30 @@ public:
   void run(const Timer::StartClock::time_point &startAt);
 
   void run(Int startIn) { run(std::chrono::seconds(startIn)); }
+
+  /// Select how the simulation waits for the next time step
+  void setTimerMode(Timer::Mode mode, const Timer::Ticks &guard =
+                                          std::chrono::microseconds(50)) {
+    mTimer.setMode(mode, guard);
+  }
+
+  void setOverrunPolicy(Timer::OverrunPolicy policy) {
+    mTimer.setOverrunPolicy(policy);
+  }
+
+  /// Wake-up lateness and compute time of the steps of the last run
+  const Timer &timer() const { return mTimer; }
+
+  /// Run a preflight phase before the timed loop. It locks the memory,
+  /// prefaults the stack, warms up the solvers and checks the worst-case
+  /// step time against the time step. It runs after the initialization and
+  /// before the interfaces are opened.
+  void setPreflight(const Preflight &preflight) {
+    mPreflight = preflight;
+    mPreflightEnabled = true;
+  }
+
+  /// Worst-case step time in seconds measured by the last preflight
+  Real worstCaseStepTime() const { return mWorstCaseStepTime; }
 };
 } // namespace DPsim
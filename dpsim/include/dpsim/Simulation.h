@@ -94,6 +94,10 @@ protected:
   Bool mInitFromNodesAndTerminals = true;
   /// Enable recomputation of system matrix during simulation
   Bool mSystemMatrixRecomputation = false;
+  /// Solve the ODEs of all components with a single integrator
+  Bool mCoupledODESolver = false;
+  /// Integrate implicitly instead of explicitly in the coupled ODE solver
+  Bool mImplicitODEIntegration = false;
 
   /// If tearing components exist, the Diakoptics
   /// solver is selected automatically.
@@ -118,6 +122,8 @@ protected:
   std::shared_ptr<Scheduler> mScheduler;
   /// List of all tasks to be scheduled
   CPS::Task::List mTasks;
+  /// Tasks of the solvers, without those of interfaces and loggers
+  CPS::Task::List mSolverTasks;
   /// Task dependencies as incoming / outgoing edges
   Scheduler::Edges mTaskInEdges, mTaskOutEdges;
 
@@ -136,6 +142,8 @@ protected:
 
   /// Helper function for constructors
   void create();
+  /// Create solvers for the configured domain into mSolvers
+  void createSolversForDomain();
   /// Create solvers depending on simulation settings
   template <typename VarType> void createSolvers();
   /// Subroutine for MNA only because there are many MNA options
@@ -213,6 +221,12 @@ public:
   void doSystemMatrixRecomputation(Bool value) {
     mSystemMatrixRecomputation = value;
   }
+  /// Integrate the ODEs of all components in one joint state vector instead
+  /// of using a separate ODE solver per component
+  void doCoupledODESolver(Bool value = true, Bool implicit = false) {
+    mCoupledODESolver = value;
+    mImplicitODEIntegration = implicit;
+  }
   /// If logStepTimes is enabled, the time needed for every timesteps is logged
   /// and can be written to a file or the console using logStepTimes()
   void setLogStepTimes(Bool f) { mLogStepTimes = f; }
@@ -234,6 +248,13 @@ public:
   void stop();
   /// Run until next time step
   Real next();
+  /// Run the given number of time steps, or fewer if the final time is
+  /// reached first. The simulation has to be started before and is not
+  /// stopped afterwards.
+  Real runSteps(UInt steps);
+  /// Run time steps until the simulation time reaches the given time, or
+  /// until the final time is exceeded
+  Real runUntil(Real time);
   /// Run simulation until total time is elapsed.
   void run();
   /// Solve system A * x = z for x and current time
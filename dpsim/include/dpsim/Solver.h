@@ -41,6 +41,8 @@ protected:
   CPS::Logger::Level mLogLevel;
   /// Collect step time for logging
   Bool mLogSolveTimes = true;
+  /// Skip the per-step logging of the solver vectors
+  Bool mLogSuspended = false;
   /// Logger
   CPS::Logger::Log mSLog;
   /// Time step for fixed step solvers
@@ -76,8 +78,9 @@ public:
 
   // #### Solver settings ####
   /// Solver types:
-  /// Modified Nodal Analysis, Differential Algebraic, Newton Raphson
-  enum class Type { MNA, DAE, NRP };
+  /// Modified Nodal Analysis, Differential Algebraic, Newton Raphson,
+  /// Fast Decoupled Load Flow
+  enum class Type { MNA, DAE, NRP, FDLF };
   ///
   void setTimeStep(Real timeStep) { mTimeStep = timeStep; }
   ///
@@ -92,6 +95,8 @@ public:
   }
 
   void setLogSolveTimes(Bool value) { mLogSolveTimes = value; }
+  /// Stop or resume the per-step logging, e.g. around a warm-up
+  void setLogSuspended(Bool value) { mLogSuspended = value; }
 
   // #### Initialization ####
   ///
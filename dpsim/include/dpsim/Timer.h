@@ -12,6 +12,7 @@
 
 #include <dpsim-models/Logger.h>
 #include <dpsim/Config.h>
+#include <dpsim/LatencyHistogram.h>
 
 namespace DPsim {
 
@@ -29,12 +30,36 @@ public:
   using StartTimePoint = std::chrono::time_point<StartClock, Ticks>;
   using IntervalTimePoint = std::chrono::time_point<IntervalClock, Ticks>;
 
+  /// How sleep() waits for the next tick
+  enum class Mode {
+    /// Block on the timer until the tick
+    Sleep,
+    /// Block until a guard interval before the tick, then spin on the
+    /// monotonic clock. Avoids the wake-up latency of the kernel at the cost
+    /// of a busy core during the guard interval.
+    Hybrid
+  };
+
+  /// What happens to the ticks missed by a step that took too long
+  enum class OverrunPolicy {
+    /// Drop the missed ticks, the next step starts with the next tick
+    Skip,
+    /// Return immediately for each missed tick until the schedule is met
+    CatchUp,
+    /// Throw an OverrunException
+    Fail
+  };
+
 protected:
   enum State { running, stopped } mState;
 
   StartTimePoint mStartAt;
+  /// Deadline of the next tick
   IntervalTimePoint mNextTick;
   Ticks mTickInterval;
+  Mode mMode = Mode::Sleep;
+  Ticks mGuard = std::chrono::microseconds(50);
+  OverrunPolicy mOverrunPolicy = OverrunPolicy::Skip;
 
 #ifdef HAVE_TIMERFD
   int mTimerFd;
@@ -42,13 +67,27 @@ protected:
   long long mOverruns;
   long long mTicks;
   int mFlags;
+  /// Missed ticks still to be caught up
+  uint64_t mPendingTicks = 0;
+  IntervalTimePoint mLastWakeup;
+
+  /// Delay between the deadline of a tick and the return of sleep()
+  LatencyHistogram mLateness;
+  /// Time between the return of sleep() and its next call
+  LatencyHistogram mComputeTime;
 
   /// Timer log level
   CPS::Logger::Level mLogLevel;
   /// Logger
   CPS::Logger::Log mSLog;
 
+  /// Wait until the deadline in mNextTick has passed. Returns the number of
+  /// ticks that passed since then, including the awaited one.
+  uint64_t waitSleep();
+  uint64_t waitHybrid();
+
 public:
+  /// `fail_on_overrun` selects OverrunPolicy::Fail
   enum Flags : int { fail_on_overrun = 1 };
 
   Timer(int flags = 0, CPS::Logger::Level logLevel = CPS::Logger::Level::debug);
@@ -69,6 +108,10 @@ public:
   // Getter
   const long long &overruns() { return mOverruns; }
 
+  const LatencyHistogram &lateness() const { return mLateness; }
+
+  const LatencyHistogram &computeTime() const { return mComputeTime; }
+
   long long ticks() { return mTicks; }
 
   Ticks interval() { return mTickInterval; }
@@ -81,6 +124,14 @@ public:
   void setInterval(double dt) {
     mTickInterval = Timer::Ticks((uintmax_t)(dt * 1e9));
   }
+
+  /// Has to be set before start()
+  void setMode(Mode mode, const Ticks &guard = std::chrono::microseconds(50)) {
+    mMode = mode;
+    mGuard = guard;
+  }
+
+  void setOverrunPolicy(OverrunPolicy policy) { mOverrunPolicy = policy; }
 };
 
 #ifdef HAVE_TIMERFD
@@ -0,0 +1,174 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#pragma once
+
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include <dpsim-models/Attribute.h>
+#include <dpsim-models/Base/Base_Ph1_Switch.h>
+#include <dpsim-models/Base/Base_Ph3_Switch.h>
+#include <dpsim-models/Filesystem.h>
+#include <dpsim-models/PtrFactory.h>
+#include <dpsim-models/Task.h>
+#include <dpsim/DataLoggerInterface.h>
+#include <dpsim/Definitions.h>
+#include <dpsim/Event.h>
+#include <dpsim/Scheduler.h>
+
+namespace DPsim {
+
+/// Logger which keeps the last steps of all attributes in memory and only
+/// writes them at full resolution in a window around trigger events.
+///
+/// A trigger writes the buffered pre-trigger window and the following
+/// post-trigger steps to the file. Another trigger within the post-trigger
+/// window extends it. Outside of these windows, only every
+/// `coarseDownsampling`-th step is written (or none, if it is zero).
+class TriggeredDataLogger
+    : public DataLoggerInterface,
+      public SharedFactory<TriggeredDataLogger>,
+      public std::enable_shared_from_this<TriggeredDataLogger> {
+
+public:
+  enum class Edge { Rising, Falling, Both };
+
+protected:
+  struct ThresholdTrigger {
+    CPS::Attribute<Real>::Ptr attr;
+    Real threshold;
+    Edge edge;
+    Real previous;
+  };
+
+  struct ChangeTrigger {
+    CPS::Attribute<Bool>::Ptr attr;
+    Bool previous;
+    Bool primed;
+  };
+
+  String mName;
+  Bool mEnabled;
+  fs::path mFilename;
+  std::ofstream mLogFile;
+
+  UInt mPreTriggerSteps;
+  UInt mPostTriggerSteps;
+  UInt mCoarseDownsampling;
+
+  std::vector<Column> mColumns;
+  /// Number of values per row including the time column
+  size_t mRowSize;
+  /// Contiguous ring of the last mPreTriggerSteps + 1 rows
+  std::vector<Real> mRing;
+  std::vector<Int> mRingSteps;
+  size_t mRingRows;
+  size_t mRingHead;
+  size_t mRingFill;
+
+  std::vector<ThresholdTrigger> mThresholdTriggers;
+  std::vector<ChangeTrigger> mChangeTriggers;
+  Bool mTriggerPending;
+  /// Remaining steps of the current post-trigger window
+  UInt mPostRemaining;
+  /// Step count of the last row written to the file
+  Int mLastWrittenStep;
+  UInt mTriggerCount;
+
+  String mBuffer;
+
+  void fillRow(Real *row, Real time);
+  bool checkTriggers();
+  void appendRow(const Real *row, Int timeStepCount);
+  void flushBuffer();
+
+public:
+  typedef std::shared_ptr<TriggeredDataLogger> Ptr;
+
+  /// @param preTriggerSteps number of steps before a trigger that are written
+  /// @param postTriggerSteps number of steps after a trigger that are written
+  /// @param coarseDownsampling downsampling outside of capture windows, zero
+  /// disables logging outside of them
+  TriggeredDataLogger(String name, UInt preTriggerSteps, UInt postTriggerSteps,
+                      UInt coarseDownsampling = 0, Bool enabled = true);
+  virtual ~TriggeredDataLogger(){};
+
+  virtual void start() override;
+  virtual void stop() override;
+
+  virtual void log(Real time, Int timeStepCount) override;
+
+  virtual CPS::Task::Ptr getTask() override;
+
+  /// Fire a trigger in the next logged step
+  void trigger() { mTriggerPending = true; }
+
+  /// Trigger when the attribute crosses the threshold
+  void addThresholdTrigger(CPS::Attribute<Real>::Ptr attr, Real threshold,
+                           Edge edge = Edge::Both);
+  /// Trigger when the boolean attribute changes its value
+  void addChangeTrigger(CPS::Attribute<Bool>::Ptr attr);
+  /// Trigger when the switch opens or closes, e.g. through a SwitchEvent
+  void addSwitchTrigger(const std::shared_ptr<CPS::Base::Ph1::Switch> &sw) {
+    addChangeTrigger(sw->mIsClosed);
+  }
+  void addSwitchTrigger(const std::shared_ptr<CPS::Base::Ph3::Switch> &sw) {
+    addChangeTrigger(sw->mIsClosed);
+  }
+  /// Wrap an event so that executing it also triggers this logger. The
+  /// logger has to be owned by a shared_ptr, e.g. created with make().
+  Event::Ptr triggerOn(Event::Ptr event);
+
+  /// Number of triggers fired so far
+  UInt triggerCount() const { return mTriggerCount; }
+
+  class Step : public CPS::Task {
+  public:
+    Step(TriggeredDataLogger &logger)
+        : Task(logger.mName + ".Write"), mLogger(logger) {
+      for (auto attr : logger.mAttributes) {
+        mAttributeDependencies.push_back(attr.second);
+      }
+      for (auto &trigger : logger.mThresholdTriggers) {
+        mAttributeDependencies.push_back(trigger.attr);
+      }
+      for (auto &trigger : logger.mChangeTriggers) {
+        mAttributeDependencies.push_back(trigger.attr);
+      }
+      mModifiedAttributes.push_back(Scheduler::external);
+    }
+
+    void execute(Real time, Int timeStepCount);
+
+  private:
+    TriggeredDataLogger &mLogger;
+  };
+};
+
+/// Event which executes another event and triggers a TriggeredDataLogger
+class TriggerEvent : public Event, public SharedFactory<TriggerEvent> {
+
+protected:
+  Event::Ptr mEvent;
+  /// Shared because the event queue may outlive the logger's other owners
+  TriggeredDataLogger::Ptr mLogger;
+
+public:
+  using SharedFactory<TriggerEvent>::make;
+
+  TriggerEvent(CPS::Real t, Event::Ptr event, TriggeredDataLogger::Ptr logger)
+      : Event(t), mEvent(event), mLogger(logger) {}
+
+  void execute() {
+    mEvent->execute();
+    mLogger->trigger();
+  }
+};
+} // namespace DPsim
@@ -0,0 +1,149 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <cmath>
+#include <iomanip>
+#include <iterator>
+#include <limits>
+
+#include <dpsim-models/Logger.h>
+#include <dpsim/AggregatingDataLogger.h>
+
+using namespace DPsim;
+
+AggregatingDataLogger::AggregatingDataLogger(String name, UInt windowSteps,
+                                             UInt statistics, Bool enabled)
+    : DataLoggerInterface(), mName(name), mEnabled(enabled),
+      mWindowSteps(windowSteps), mStatistics(statistics), mWindowFill(0),
+      mLastTime(0) {
+  if (mWindowSteps == 0)
+    throw std::invalid_argument(
+        "AggregatingDataLogger: window must contain at least one step");
+  if (mStatistics == 0)
+    throw std::invalid_argument(
+        "AggregatingDataLogger: at least one statistic must be enabled");
+
+  if (!mEnabled)
+    return;
+
+  mFilename = CPS::Logger::logDir() + "/" + name + ".csv";
+
+  if (mFilename.has_parent_path() && !fs::exists(mFilename.parent_path()))
+    fs::create_directory(mFilename.parent_path());
+}
+
+void AggregatingDataLogger::resetWindow() {
+  mMin.setConstant(std::numeric_limits<Real>::infinity());
+  mMax.setConstant(-std::numeric_limits<Real>::infinity());
+  mSum.setZero();
+  mSumSquares.setZero();
+  mWindowFill = 0;
+}
+
+void AggregatingDataLogger::start() {
+  if (!mEnabled)
+    return;
+
+  mColumns = resolveColumns("AggregatingDataLogger");
+  Eigen::Index size = static_cast<Eigen::Index>(mColumns.size());
+  mValues = Eigen::ArrayXd::Zero(size);
+  mMin.resize(size);
+  mMax.resize(size);
+  mSum.resize(size);
+  mSumSquares.resize(size);
+  resetWindow();
+  mBuffer.reserve(WRITE_CHUNK_SIZE);
+
+  mLogFile =
+      std::ofstream(mFilename, std::ios_base::out | std::ios_base::trunc);
+  if (!mLogFile.is_open())
+    throw std::runtime_error("AggregatingDataLogger: Cannot open log file " +
+                             mFilename.string());
+
+  mLogFile << std::right << std::setw(14) << "time";
+  for (auto &it : mAttributes) {
+    if (mStatistics & Min)
+      mLogFile << ", " << std::right << std::setw(13) << it.first + ".min";
+    if (mStatistics & Max)
+      mLogFile << ", " << std::right << std::setw(13) << it.first + ".max";
+    if (mStatistics & Mean)
+      mLogFile << ", " << std::right << std::setw(13) << it.first + ".mean";
+    if (mStatistics & RMS)
+      mLogFile << ", " << std::right << std::setw(13) << it.first + ".rms";
+    if (mStatistics & Last)
+      mLogFile << ", " << std::right << std::setw(13) << it.first + ".last";
+  }
+  mLogFile << '\n';
+}
+
+void AggregatingDataLogger::stop() {
+  if (!mEnabled)
+    return;
+
+  // Write the incomplete last window
+  if (mWindowFill > 0)
+    writeWindow();
+  flushBuffer();
+  mLogFile.close();
+}
+
+void AggregatingDataLogger::writeWindow() {
+  Real count = static_cast<Real>(mWindowFill);
+  auto out = std::back_inserter(mBuffer);
+
+  fmt::format_to(out, "{:>14e}", mLastTime);
+  for (Eigen::Index i = 0; i < mValues.size(); ++i) {
+    if (mStatistics & Min)
+      fmt::format_to(out, ", {:>13e}", mMin(i));
+    if (mStatistics & Max)
+      fmt::format_to(out, ", {:>13e}", mMax(i));
+    if (mStatistics & Mean)
+      fmt::format_to(out, ", {:>13e}", mSum(i) / count);
+    if (mStatistics & RMS)
+      fmt::format_to(out, ", {:>13e}", std::sqrt(mSumSquares(i) / count));
+    if (mStatistics & Last)
+      fmt::format_to(out, ", {:>13e}", mValues(i));
+  }
+  mBuffer.push_back('\n');
+
+  if (mBuffer.size() >= WRITE_CHUNK_SIZE)
+    flushBuffer();
+
+  resetWindow();
+}
+
+void AggregatingDataLogger::flushBuffer() {
+  mLogFile.write(mBuffer.data(), mBuffer.size());
+  mBuffer.clear();
+}
+
+void AggregatingDataLogger::log(Real time, Int timeStepCount) {
+  if (!mEnabled)
+    return;
+
+  for (size_t i = 0; i < mColumns.size(); ++i)
+    mValues(i) = mColumns[i].value();
+
+  // Update the statistics of all columns at once
+  mMin = mMin.min(mValues);
+  mMax = mMax.max(mValues);
+  mSum += mValues;
+  mSumSquares += mValues.square();
+  mLastTime = time;
+
+  if (++mWindowFill == mWindowSteps)
+    writeWindow();
+}
+
+void AggregatingDataLogger::Step::execute(Real time, Int timeStepCount) {
+  mLogger.log(time, timeStepCount);
+}
+
+CPS::Task::Ptr AggregatingDataLogger::getTask() {
+  return std::make_shared<AggregatingDataLogger::Step>(*this);
+}
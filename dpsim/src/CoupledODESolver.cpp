@@ -0,0 +1,214 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <algorithm>
+
+#include <dpsim/CoupledODESolver.h>
+
+using namespace DPsim;
+
+CoupledODESolver::CoupledODESolver(
+    String name, const std::vector<CPS::ODEInterface::Ptr> &components,
+    bool implicit_integration, Real timestep, CPS::Logger::Level logLevel)
+    : Solver(name, logLevel), mComponents(components),
+      mImplicitIntegration(implicit_integration), mTimestep(timestep) {
+  Int maxSize = 0;
+  for (auto &comp : mComponents) {
+    Int size = static_cast<Int>(comp->mOdePreState->get().rows());
+    mOffsets.push_back(mProbDim);
+    mSizes.push_back(size);
+    mProbDim += size;
+    maxSize = std::max(maxSize, size);
+  }
+  mBlock = CPS::Matrix::Zero(maxSize, maxSize);
+  mStates = N_VNew_Serial(mProbDim);
+
+  SPDLOG_LOGGER_INFO(mSLog, "{} components with {} states in total",
+                     mComponents.size(), mProbDim);
+}
+
+void CoupledODESolver::checkFlag(int flag, const std::string &funcname) {
+  if (flag < 0)
+    throw CPS::SystemError("SUNDIALS: " + funcname + " failed with flag " +
+                           std::to_string(flag));
+}
+
+int CoupledODESolver::StateSpaceWrapper(realtype t, N_Vector y, N_Vector ydot,
+                                        void *user_data) {
+  CoupledODESolver *self = reinterpret_cast<CoupledODESolver *>(user_data);
+  return self->StateSpace(t, y, ydot);
+}
+
+int CoupledODESolver::StateSpace(realtype t, N_Vector y, N_Vector ydot) {
+  const double *yData = NV_DATA_S(y);
+  double *ydotData = NV_DATA_S(ydot);
+  for (UInt c = 0; c < mComponents.size(); ++c)
+    mComponents[c]->odeStateSpace(t, yData + mOffsets[c],
+                                  ydotData + mOffsets[c]);
+  return 0;
+}
+
+int CoupledODESolver::JacobianWrapper(realtype t, N_Vector y, N_Vector fy,
+                                      SUNMatrix J, void *user_data,
+                                      N_Vector tmp1, N_Vector tmp2,
+                                      N_Vector tmp3) {
+  CoupledODESolver *self = reinterpret_cast<CoupledODESolver *>(user_data);
+  return self->Jacobian(t, y, fy, J, tmp1, tmp2, tmp3);
+}
+
+int CoupledODESolver::Jacobian(realtype t, N_Vector y, N_Vector fy,
+                               SUNMatrix J, N_Vector tmp1, N_Vector tmp2,
+                               N_Vector tmp3) {
+#ifdef WITH_SUNDIALS_KLU
+  // Block diagonal pattern in compressed columns, rewritten on every call
+  // because SUNDIALS may zero the whole matrix in between
+  sunindextype idx = 0;
+#else
+  SUNMatZero(J);
+#endif
+  for (UInt c = 0; c < mComponents.size(); ++c) {
+    Int off = mOffsets[c];
+    Int size = mSizes[c];
+    // Components expect a dense column-major block of their own size
+    mComponents[c]->odeJacobian(
+        t, NV_DATA_S(y) + off, NV_DATA_S(fy) + off, mBlock.data(),
+        NV_DATA_S(tmp1) + off, NV_DATA_S(tmp2) + off, NV_DATA_S(tmp3) + off);
+
+    for (Int col = 0; col < size; ++col) {
+#ifdef WITH_SUNDIALS_KLU
+      SM_INDEXPTRS_S(J)[off + col] = idx;
+#endif
+      for (Int row = 0; row < size; ++row) {
+        Real value = mBlock.data()[col * size + row];
+#ifdef WITH_SUNDIALS_KLU
+        SM_INDEXVALS_S(J)[idx] = off + row;
+        SM_DATA_S(J)[idx] = value;
+        ++idx;
+#else
+        SM_ELEMENT_D(J, off + row, off + col) = value;
+#endif
+      }
+    }
+  }
+#ifdef WITH_SUNDIALS_KLU
+  SM_INDEXPTRS_S(J)[mProbDim] = idx;
+#endif
+  return 0;
+}
+
+void CoupledODESolver::createIntegrator(Real initial_time) {
+  mArkode_mem = ARKodeCreate();
+  if (!mArkode_mem)
+    throw CPS::SystemError("SUNDIALS: ARKodeCreate failed");
+
+  checkFlag(ARKodeSetUserData(mArkode_mem, this), "ARKodeSetUserData");
+
+  if (mImplicitIntegration) {
+    checkFlag(ARKodeInit(mArkode_mem, NULL,
+                         &CoupledODESolver::StateSpaceWrapper, initial_time,
+                         mStates),
+              "ARKodeInit");
+
+#ifdef WITH_SUNDIALS_KLU
+    sunindextype nnz = 0;
+    for (auto size : mSizes)
+      nnz += static_cast<sunindextype>(size) * size;
+    A = SUNSparseMatrix(mProbDim, mProbDim, nnz, CSC_MAT);
+    if (!A)
+      throw CPS::SystemError("SUNDIALS: SUNSparseMatrix failed");
+    LS = SUNKLU(mStates, A);
+#else
+    A = SUNDenseMatrix(mProbDim, mProbDim);
+    if (!A)
+      throw CPS::SystemError("SUNDIALS: SUNDenseMatrix failed");
+    LS = SUNDenseLinearSolver(mStates, A);
+#endif
+    if (!LS)
+      throw CPS::SystemError("SUNDIALS: creating the linear solver failed");
+
+    checkFlag(ARKDlsSetLinearSolver(mArkode_mem, LS, A),
+              "ARKDlsSetLinearSolver");
+    checkFlag(ARKDlsSetJacFn(mArkode_mem, &CoupledODESolver::JacobianWrapper),
+              "ARKDlsSetJacFn");
+  } else {
+    checkFlag(ARKodeInit(mArkode_mem, &CoupledODESolver::StateSpaceWrapper,
+                         NULL, initial_time, mStates),
+              "ARKodeInit");
+  }
+
+  checkFlag(ARKodeSStolerances(mArkode_mem, reltol, abstol),
+            "ARKodeSStolerances");
+  mIntegratorStarted = true;
+}
+
+Real CoupledODESolver::step(Real initial_time) {
+  realtype T0 = (realtype)initial_time;
+  realtype Tf = (realtype)initial_time + mTimestep;
+
+  double *states = NV_DATA_S(mStates);
+  for (UInt c = 0; c < mComponents.size(); ++c) {
+    const CPS::Matrix &pre = **mComponents[c]->mOdePreState;
+    std::copy_n(pre.data(), mSizes[c], states + mOffsets[c]);
+  }
+
+  // As in ODESolver, any change of the states between steps is treated as a
+  // discontinuity which restarts the integration
+  Eigen::Map<CPS::Vector> stateMap(states, mProbDim);
+  bool continuous = mIntegratorStarted && initial_time == mLastTime &&
+                    stateMap == mLastState;
+
+  if (!mIntegratorStarted) {
+    createIntegrator(initial_time);
+  } else if (!continuous) {
+    if (mImplicitIntegration)
+      checkFlag(ARKodeReInit(mArkode_mem, NULL,
+                             &CoupledODESolver::StateSpaceWrapper,
+                             initial_time, mStates),
+                "ARKodeReInit");
+    else
+      checkFlag(ARKodeReInit(mArkode_mem,
+                             &CoupledODESolver::StateSpaceWrapper, NULL,
+                             initial_time, mStates),
+                "ARKodeReInit");
+  }
+
+  checkFlag(ARKodeSetStopTime(mArkode_mem, Tf), "ARKodeSetStopTime");
+
+  realtype t = T0;
+  while (Tf - t > 1.0e-15) {
+    int flag = ARKode(mArkode_mem, Tf, mStates, &t, ARK_NORMAL);
+    if (flag < 0) {
+      SPDLOG_LOGGER_ERROR(mSLog, "ARKode failed with flag {} at {}", flag, t);
+      break;
+    }
+  }
+
+  for (UInt c = 0; c < mComponents.size(); ++c) {
+    CPS::Matrix &post = **mComponents[c]->mOdePostState;
+    post.resize(mSizes[c], 1);
+    std::copy_n(states + mOffsets[c], mSizes[c], post.data());
+  }
+  mLastTime = Tf;
+  mLastState = stateMap;
+
+  return Tf;
+}
+
+void CoupledODESolver::SolveTask::execute(Real time, Int timeStepCount) {
+  mSolver.step(time);
+}
+
+CoupledODESolver::~CoupledODESolver() {
+  if (mArkode_mem)
+    ARKodeFree(&mArkode_mem);
+  if (LS)
+    SUNLinSolFree(LS);
+  if (A)
+    SUNMatDestroy(A);
+  N_VDestroy(mStates);
+}
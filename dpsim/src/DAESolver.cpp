@@ -6,6 +6,8 @@
  * file, You can obtain one at https://mozilla.org/MPL/2.0/.
  *********************************************************************************/
 
+#include <algorithm>
+
 #include <dpsim-models/SimPowerComp.h>
 #include <dpsim-models/Solver/MNAInterface.h>
 #include <dpsim/DAESolver.h>
@@ -29,11 +31,11 @@ DAESolver::DAESolver(String name, const CPS::SystemTopology &system, Real dt,
   // Set initial values of all required variables and create IDA solver environment
   for (IdentifiedObject::Ptr comp : mSystem.mComponents) {
     auto daeComp = std::dynamic_pointer_cast<DAEInterface>(comp);
-    std::cout << "Added Comp" << std::endl;
     if (!daeComp)
       throw CPS::
           Exception(); // Component does not support the DAE solver interface
 
+    SPDLOG_LOGGER_DEBUG(mSLog, "Added component {}", comp->name());
     mComponents.push_back(comp);
   }
 
@@ -42,15 +44,13 @@ DAESolver::DAESolver(String name, const CPS::SystemTopology &system, Real dt,
     if (!baseNode->isGround()) {
       auto node = std::dynamic_pointer_cast<CPS::SimNode<Complex>>(baseNode);
       mNodes.push_back(node);
-      std::cout << "Added Node" << std::endl;
+      SPDLOG_LOGGER_DEBUG(mSLog, "Added node {}", node->name());
     }
   }
 
   mNEQ = mComponents.size() + (2 * mNodes.size());
-  std::cout << std::endl;
-  std::cout << "Number of Eqn. " << mNEQ << std::endl;
+  SPDLOG_LOGGER_INFO(mSLog, "Number of equations: {}", mNEQ);
 
-  std::cout << "Processing Nodes" << std::endl;
   UInt matrixNodeIndexIdx = 0;
 
   for (UInt idx = 0; idx < mNodes.size(); ++idx) {
@@ -65,7 +65,6 @@ DAESolver::DAESolver(String name, const CPS::SystemTopology &system, Real dt,
     }
   }
 
-  std::cout << "Nodes Setup Done" << std::endl;
   mT0 = t0;
   initialize();
 }
@@ -74,17 +73,13 @@ void DAESolver::initialize() {
   int ret;
   int counter = 0;
   realtype *sval = NULL, *s_dtval = NULL;
-  std::cout << "Init states" << std::endl;
 
   // Allocate state vectors
   state = N_VNew_Serial(mNEQ);
   dstate_dt = N_VNew_Serial(mNEQ);
 
-  std::cout << "State Init done" << std::endl;
-  std::cout << "Pointer Init" << std::endl;
   sval = N_VGetArrayPointer_Serial(state);
   s_dtval = N_VGetArrayPointer_Serial(dstate_dt);
-  std::cout << "Pointer Init done" << std::endl << std::endl;
 
   for (auto node : mNodes) {
     // Initialize nodal voltages of state vector
@@ -92,7 +87,7 @@ void DAESolver::initialize() {
     PhaseType phase = node->phaseType();
     tempVolt = std::real(node->initialSingleVoltage(phase));
 
-    std::cout << "Node Volt " << counter << ": " << tempVolt << std::endl;
+    SPDLOG_LOGGER_DEBUG(mSLog, "Node voltage {}: {}", counter, tempVolt);
     sval[counter++] = tempVolt;
   }
 
@@ -109,60 +104,53 @@ void DAESolver::initialize() {
 
     // Initialize component values of state vector
     sval[counter++] = std::real(daeComp->daeInitialize());
-    std::cout << "Comp Volt " << counter - 1 << ": " << sval[counter - 1]
-              << std::endl;
+    SPDLOG_LOGGER_DEBUG(mSLog, "Component voltage {}: {}", counter - 1,
+                        sval[counter - 1]);
     //		sval[counter++] = component inductance;
 
-    // Register residual functions of components
+    // Register residual and Jacobian functions of components
 
     mResidualFunctions.push_back(
         [daeComp](double ttime, const double state[], const double dstate_dt[],
                   double resid[], std::vector<int> &off) {
           daeComp->daeResidual(ttime, state, dstate_dt, resid, off);
         });
+    mJacobianFunctions.push_back(
+        [daeComp](double ttime, const double state[], const double dstate_dt[],
+                  double cj, DAEInterface::JacobianEntries &entries,
+                  std::vector<int> &off) {
+          return daeComp->daeJacobian(ttime, state, dstate_dt, cj, entries,
+                                      off);
+        });
   }
 
   for (int j = 0; j < (int)mNodes.size(); j++) {
     // Initialize nodal current equations
     sval[counter++] = 0; //TODO: check for correctness
-    std::cout << "Nodal Equation value " << sval[counter - 1] << std::endl;
   }
 
-  std::cout << std::endl;
-
   // Set initial values for state derivative for now all equal to 0
   for (int i = 0; i < (mNEQ); i++) {
     s_dtval[i] = 0; // TODO: add derivative calculation
-    std::cout << "derivative " << i << ": " << s_dtval[i] << std::endl;
   }
 
-  std::cout << std::endl;
-
-  std::cout << "Init Tolerances" << std::endl;
   rtol = RCONST(1.0e-10);  // Set relative tolerance
   abstol = RCONST(1.0e-4); // Set absolute error
-  std::cout << "Init Tolerances done" << std::endl;
 
   mem = IDACreate();
-  if (mem != NULL)
-    std::cout << "Memory Ok" << std::endl;
-  std::cout << "Define Userdata" << std::endl;
+  if (mem == NULL)
+    throw CPS::SystemError("IDACreate failed");
   // This passes the solver instance as the user_data argument to the residual functions
   ret = IDASetUserData(mem, this);
 
-  std::cout << "Call IDAInit" << std::endl;
-
   ret =
       IDAInit(mem, &DAESolver::residualFunctionWrapper, mT0, state, dstate_dt);
+  if (ret != IDA_SUCCESS)
+    throw CPS::SystemError("IDAInit failed with flag " + std::to_string(ret));
 
-  std::cout << "Call IDATolerances" << std::endl;
   ret = IDASStolerances(mem, rtol, abstol);
 
-  std::cout << "Call IDA Solver Stuff" << std::endl;
-  // Allocate and connect Matrix A and solver LS to IDA
-  A = SUNDenseMatrix(mNEQ, mNEQ);
-  LS = SUNDenseLinearSolver(state, A);
-  ret = IDADlsSetLinearSolver(mem, LS, A);
+  createLinearSolver();
 
   //TODO: Optional IDA input functions
   //ret = IDASetMaxNumSteps(mem, -1);  //Max. number of timesteps until tout (-1 = unlimited)
@@ -170,6 +158,50 @@ void DAESolver::initialize() {
   (void)ret;
 }
 
+void DAESolver::createLinearSolver() {
+  int ret;
+
+  // The pattern of the initial Jacobian is kept for the whole simulation
+  mAnalyticJacobian =
+      mUseAnalyticJacobian &&
+      assembleJacobian(mT0, 1., NV_DATA_S(state), NV_DATA_S(dstate_dt));
+
+#ifdef WITH_SUNDIALS_KLU
+  mSparseJacobian = mAnalyticJacobian;
+#endif
+
+  if (mSparseJacobian) {
+#ifdef WITH_SUNDIALS_KLU
+    A = SUNSparseMatrix(mNEQ, mNEQ, mJacobian.nonZeros(), CSC_MAT);
+    LS = SUNKLU(state, A);
+#endif
+  } else {
+    A = SUNDenseMatrix(mNEQ, mNEQ);
+    LS = SUNDenseLinearSolver(state, A);
+  }
+  if (A == NULL || LS == NULL)
+    throw CPS::SystemError("Creating the IDA linear solver failed");
+
+  ret = IDADlsSetLinearSolver(mem, LS, A);
+  if (ret != IDADLS_SUCCESS)
+    throw CPS::SystemError("IDADlsSetLinearSolver failed with flag " +
+                           std::to_string(ret));
+
+  if (mAnalyticJacobian) {
+    ret = IDADlsSetJacFn(mem, &DAESolver::jacobianFunctionWrapper);
+    if (ret != IDADLS_SUCCESS)
+      throw CPS::SystemError("IDADlsSetJacFn failed with flag " +
+                             std::to_string(ret));
+  }
+
+  SPDLOG_LOGGER_INFO(mSLog, "Jacobian: {}, {} nonzeros",
+                     mSparseJacobian     ? "sparse analytic (KLU)"
+                     : mAnalyticJacobian ? "dense analytic"
+                                         : "dense difference quotient",
+                     mAnalyticJacobian ? mJacobian.nonZeros()
+                                       : (long)mNEQ * mNEQ);
+}
+
 int DAESolver::residualFunctionWrapper(realtype ttime, N_Vector state,
                                        N_Vector dstate_dt, N_Vector resid,
                                        void *user_data) {
@@ -206,24 +238,83 @@ int DAESolver::residualFunction(realtype ttime, N_Vector state,
   return 0;
 }
 
+bool DAESolver::assembleJacobian(realtype ttime, realtype cj,
+                                 const double state[],
+                                 const double dstate_dt[]) {
+  mOffsets[0] = 0;
+  mOffsets[1] = 0;
+  mJacobianEntries.clear();
+
+  // The nodal voltage equations only depend on their own state
+  for (UInt i = 0; i < mNodes.size(); ++i) {
+    mJacobianEntries.emplace_back(mOffsets[0], mOffsets[0], -1.);
+    mOffsets[0] += 1;
+  }
+
+  for (auto &jacFn : mJacobianFunctions) {
+    if (!jacFn(ttime, state, dstate_dt, cj, mJacobianEntries, mOffsets))
+      return false;
+  }
+
+  mJacobian.resize(mNEQ, mNEQ);
+  mJacobian.setFromTriplets(mJacobianEntries.begin(), mJacobianEntries.end());
+  mJacobian.makeCompressed();
+  return true;
+}
+
+int DAESolver::jacobianFunctionWrapper(realtype ttime, realtype cj,
+                                       N_Vector state, N_Vector dstate_dt,
+                                       N_Vector resid, SUNMatrix J,
+                                       void *user_data, N_Vector tmp1,
+                                       N_Vector tmp2, N_Vector tmp3) {
+  DAESolver *self = reinterpret_cast<DAESolver *>(user_data);
+
+  return self->jacobianFunction(ttime, cj, state, dstate_dt, J);
+}
+
+int DAESolver::jacobianFunction(realtype ttime, realtype cj, N_Vector state,
+                                N_Vector dstate_dt, SUNMatrix J) {
+  if (!assembleJacobian(ttime, cj, NV_DATA_S(state), NV_DATA_S(dstate_dt)))
+    return -1;
+
+  if (mSparseJacobian) {
+#ifdef WITH_SUNDIALS_KLU
+    // Components add the same entries on every call, so the pattern only
+    // grows if a component violates this contract
+    if (mJacobian.nonZeros() > SM_NNZ_S(J) &&
+        SUNSparseMatrix_Reallocate(J, mJacobian.nonZeros()) != 0)
+      return -1;
+
+    std::copy_n(mJacobian.outerIndexPtr(), mNEQ + 1, SM_INDEXPTRS_S(J));
+    std::copy_n(mJacobian.innerIndexPtr(), mJacobian.nonZeros(),
+                SM_INDEXVALS_S(J));
+    std::copy_n(mJacobian.valuePtr(), mJacobian.nonZeros(), SM_DATA_S(J));
+#endif
+  } else {
+    SUNMatZero(J);
+    for (Int col = 0; col < mJacobian.outerSize(); ++col)
+      for (decltype(mJacobian)::InnerIterator it(mJacobian, col); it; ++it)
+        SM_ELEMENT_D(J, it.row(), col) = it.value();
+  }
+  return 0;
+}
+
 Real DAESolver::step(Real time) {
 
   Real NextTime = time + mTimestep;
-  std::cout << "Current Time " << NextTime << std::endl;
   int ret = IDASolve(mem, NextTime, &tret, state, dstate_dt,
                      IDA_NORMAL); // TODO: find alternative to IDA_NORMAL
 
-  if (ret == IDA_SUCCESS) {
-    return NextTime;
-  } else {
-    std::cout << "Ida Error " << ret << std::endl;
+  if (ret != IDA_SUCCESS) {
     //throw CPS::Exception();
     void(IDAGetNumSteps(mem, &interalSteps));
     void(IDAGetNumResEvals(mem, &resEval));
-    std::cout << "Interal steps: " << interalSteps << std::endl;
-    std::cout << "Res Eval :" << resEval << std::endl;
-    return NextTime;
+    SPDLOG_LOGGER_ERROR(mSLog,
+                        "IDA error {} at {}, internal steps: {}, residual "
+                        "evaluations: {}",
+                        ret, NextTime, interalSteps, resEval);
   }
+  return NextTime;
 }
 
 Task::List DAESolver::getTasks() {
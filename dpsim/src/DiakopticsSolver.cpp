@@ -22,12 +22,23 @@ namespace DPsim {
 template <typename VarType>
 DiakopticsSolver<VarType>::DiakopticsSolver(
     String name, SystemTopology system, IdentifiedObject::List tearComponents,
-    Real timeStep, Logger::Level logLevel)
-    : Solver(name, logLevel),
+    Real timeStep, Logger::Level logLevel,
+    DirectLinearSolverImpl implementation,
+    DirectLinearSolverConfiguration configuration)
+    : Solver(name, logLevel), mImplementation(implementation),
+      mLinearSolverConfiguration(configuration),
       mMappedTearCurrents(AttributeStatic<Matrix>::make()),
       mOrigLeftSideVector(AttributeStatic<Matrix>::make()) {
   mTimeStep = timeStep;
 
+  if (mImplementation == DirectLinearSolverImpl::Undef) {
+#ifdef WITH_KLU
+    mImplementation = DirectLinearSolverImpl::KLU;
+#else
+    mImplementation = DirectLinearSolverImpl::SparseLU;
+#endif
+  }
+
   // Raw source and solution vector logging
   mLeftVectorLog = std::make_shared<DataLogger>(
       name + "_LeftVector", logLevel != CPS::Logger::Level::off);
@@ -216,8 +227,6 @@ template <> void DiakopticsSolver<Complex>::setLogColumns() {
 
 template <typename VarType> void DiakopticsSolver<VarType>::createMatrices() {
   UInt totalSize = mSubnets.back().sysOff + mSubnets.back().sysSize;
-  mSystemMatrix = Matrix::Zero(totalSize, totalSize);
-  mSystemInverse = Matrix::Zero(totalSize, totalSize);
 
   mRightSideVector = Matrix::Zero(totalSize, 1);
   mLeftSideVector = Matrix::Zero(totalSize, 1);
@@ -230,6 +239,8 @@ template <typename VarType> void DiakopticsSolver<VarType>::createMatrices() {
     // copy the solution there
     net.leftVector = AttributeStatic<Matrix>::make();
     net.leftVector->set(Matrix::Zero(net.sysSize, 1));
+    net.rightVector = Matrix::Zero(net.sysSize, 1);
+    net.mappedTearCurrents = Matrix::Zero(net.sysSize, 1);
   }
 
   createTearMatrices(totalSize);
@@ -241,7 +252,7 @@ template <> void DiakopticsSolver<Real>::createTearMatrices(UInt totalSize) {
     phaseMultiplier = 3;
   }
   mTearTopology =
-      Matrix::Zero(totalSize, mTearComponents.size() * phaseMultiplier);
+      SparseMatrix(totalSize, mTearComponents.size() * phaseMultiplier);
   mTearImpedance =
       CPS::SparseMatrixRow(mTearComponents.size() * phaseMultiplier,
                            mTearComponents.size() * phaseMultiplier);
@@ -255,7 +266,7 @@ template <> void DiakopticsSolver<Complex>::createTearMatrices(UInt totalSize) {
     phaseMultiplier = 3;
   }
   mTearTopology =
-      Matrix::Zero(totalSize, 2 * mTearComponents.size() * phaseMultiplier);
+      SparseMatrix(totalSize, 2 * mTearComponents.size() * phaseMultiplier);
   mTearImpedance =
       CPS::SparseMatrixRow(2 * mTearComponents.size() * phaseMultiplier,
                            2 * mTearComponents.size() * phaseMultiplier);
@@ -287,41 +298,84 @@ template <typename VarType> void DiakopticsSolver<VarType>::initComponents() {
     comp->initialize(mSystem.mSystemOmega, mTimeStep);
 }
 
+template <typename VarType>
+std::shared_ptr<DirectLinearSolver>
+DiakopticsSolver<VarType>::createLinearSolver() {
+  std::shared_ptr<DirectLinearSolver> solver;
+  switch (mImplementation) {
+  case DirectLinearSolverImpl::DenseLU:
+    solver = std::make_shared<DenseLUAdapter>(mSLog);
+    break;
+  case DirectLinearSolverImpl::SparseLU:
+    solver = std::make_shared<SparseLUAdapter>(mSLog);
+    break;
+#ifdef WITH_KLU
+  case DirectLinearSolverImpl::KLU:
+    solver = std::make_shared<KLUAdapter>(mSLog);
+    // Only KLU evaluates the configuration, the others would warn about it
+    solver->setConfiguration(mLinearSolverConfiguration);
+    break;
+#endif
+  default:
+    throw CPS::SystemError(
+        "unsupported linear solver implementation for diakoptics.");
+  }
+  return solver;
+}
+
 template <typename VarType> void DiakopticsSolver<VarType>::initMatrices() {
+  std::vector<std::pair<UInt, UInt>> noVariableEntries;
   for (auto &net : mSubnets) {
-    // We can't directly pass the block reference to mnaApplySystemMatrixStamp,
-    // because it expects a concrete Matrix. It can't be changed to accept some common
-    // base class like DenseBase because that would make it a template function (as
-    // Eigen uses CRTP for polymorphism), which is impossible for virtual functions.
-    CPS::SparseMatrixRow partSys =
-        CPS::SparseMatrixRow(net.sysSize, net.sysSize);
+    net.systemMatrix = SparseMatrix(net.sysSize, net.sysSize);
     for (auto comp : net.components) {
-      comp->mnaApplySystemMatrixStamp(partSys);
+      comp->mnaApplySystemMatrixStamp(net.systemMatrix);
     }
-    auto block =
-        mSystemMatrix.block(net.sysOff, net.sysOff, net.sysSize, net.sysSize);
-    block = partSys;
-    SPDLOG_LOGGER_INFO(mSLog, "Block: \n{}", block);
-    net.luFactorization = Eigen::PartialPivLU<Matrix>(partSys);
-    SPDLOG_LOGGER_INFO(mSLog, "Factorization: \n{}",
-                       net.luFactorization.matrixLU());
+    net.systemMatrix.makeCompressed();
+    SPDLOG_LOGGER_INFO(mSLog, "Block with {} nonzeros: \n{}",
+                       net.systemMatrix.nonZeros(), net.systemMatrix);
+
+    net.linearSolver = createLinearSolver();
+    net.linearSolver->preprocessing(net.systemMatrix, noVariableEntries);
+    net.linearSolver->factorize(net.systemMatrix);
   }
-  SPDLOG_LOGGER_INFO(mSLog, "Complete system matrix: \n{}", mSystemMatrix);
 
   // initialize tear topology matrix and impedance matrix of removed network
+  std::vector<Eigen::Triplet<Real>> topology;
   for (UInt compIdx = 0; compIdx < mTearComponents.size(); ++compIdx) {
-    applyTearComponentStamp(compIdx);
+    applyTearComponentStamp(compIdx, topology);
   }
+  mTearTopology.setFromTriplets(topology.begin(), topology.end());
   SPDLOG_LOGGER_INFO(mSLog, "Topology matrix: \n{}", mTearTopology);
   SPDLOG_LOGGER_INFO(mSLog, "Removed impedance matrix: \n{}", mTearImpedance);
-  // TODO this can be sped up as well by using the block diagonal form of Yinv
+
+  // Z' = Z + C^T * Y^-1 * C. As Y is block diagonal, every subnet only needs
+  // solves for the tear topology columns with entries in its rows.
+  Matrix totalTearImpedance = mTearImpedance;
   for (auto &net : mSubnets) {
-    mSystemInverse.block(net.sysOff, net.sysOff, net.sysSize, net.sysSize) =
-        net.luFactorization.inverse();
+    CPS::SparseMatrix block =
+        mTearTopology.middleRows(net.sysOff, net.sysSize);
+    std::vector<UInt> columns;
+    for (UInt col = 0; col < block.cols(); ++col) {
+      if (block.col(col).nonZeros() > 0)
+        columns.push_back(col);
+    }
+    if (columns.empty())
+      continue;
+
+    Matrix rhs = Matrix::Zero(net.sysSize, columns.size());
+    for (UInt i = 0; i < columns.size(); ++i) {
+      for (CPS::SparseMatrix::InnerIterator it(block, columns[i]); it; ++it)
+        rhs(it.row(), i) = it.value();
+    }
+    Matrix x = net.linearSolver->solve(rhs);
+
+    for (UInt i = 0; i < columns.size(); ++i) {
+      for (UInt j = 0; j < columns.size(); ++j)
+        totalTearImpedance(columns[i], columns[j]) +=
+            block.col(columns[i]).dot(x.col(j));
+    }
   }
-  mTotalTearImpedance = Eigen::PartialPivLU<Matrix>(
-      mTearImpedance +
-      mTearTopology.transpose() * mSystemInverse * mTearTopology);
+  mTotalTearImpedance = Eigen::PartialPivLU<Matrix>(totalTearImpedance);
   SPDLOG_LOGGER_INFO(mSLog,
                      "Total removed impedance matrix LU decomposition: \n{}",
                      mTotalTearImpedance.matrixLU());
@@ -337,12 +391,11 @@ template <typename VarType> void DiakopticsSolver<VarType>::initMatrices() {
   }
 }
 
-template <> void DiakopticsSolver<Real>::applyTearComponentStamp(UInt compIdx) {
+template <>
+void DiakopticsSolver<Real>::applyTearComponentStamp(
+    UInt compIdx, std::vector<Eigen::Triplet<Real>> &triplets) {
   auto comp = mTearComponents[compIdx];
 
-  // Use triplets to populate the sparse matrix
-  std::vector<Eigen::Triplet<double>> triplets;
-
   // Node 0 contributions
   if (comp->node(0)->phaseType() == CPS::PhaseType::ABC) {
     triplets.emplace_back(mNodeSubnetMap[comp->node(0)]->sysOff +
@@ -377,23 +430,16 @@ template <> void DiakopticsSolver<Real>::applyTearComponentStamp(UInt compIdx) {
                           compIdx, -1);
   }
 
-  // Apply triplets to the sparse matrix
-  for (const auto &triplet : triplets) {
-    mTearTopology.coeffRef(triplet.row(), triplet.col()) += triplet.value();
-  }
-
   // Call tear component stamp function
   auto tearComp = std::dynamic_pointer_cast<MNATearInterface>(comp);
   tearComp->mnaTearApplyMatrixStamp(mTearImpedance);
 }
 
 template <>
-void DiakopticsSolver<Complex>::applyTearComponentStamp(UInt compIdx) {
+void DiakopticsSolver<Complex>::applyTearComponentStamp(
+    UInt compIdx, std::vector<Eigen::Triplet<Real>> &triplets) {
   auto comp = mTearComponents[compIdx];
 
-  // Use triplets to populate the sparse matrix
-  std::vector<Eigen::Triplet<double>> triplets;
-
   // Node 0 contributions
   if (comp->node(0)->phaseType() == CPS::PhaseType::ABC) {
     triplets.emplace_back(mNodeSubnetMap[comp->node(0)]->sysOff +
@@ -464,11 +510,6 @@ void DiakopticsSolver<Complex>::applyTearComponentStamp(UInt compIdx) {
                               comp->node(1)->matrixNodeIndex(),
                           mTearComponents.size() + compIdx, double(-1.0));
   }
-  // Apply triplets to the sparse matrix
-  for (const auto &triplet : triplets) {
-    mTearTopology.coeffRef(triplet.row(), triplet.col()) += triplet.value();
-  }
-
   // Call tear component stamp function
   auto tearComp = std::dynamic_pointer_cast<MNATearInterface>(comp);
   tearComp->mnaTearApplyMatrixStamp(mTearImpedance);
@@ -507,17 +548,16 @@ template <typename VarType> Task::List DiakopticsSolver<VarType>::getTasks() {
 template <typename VarType>
 void DiakopticsSolver<VarType>::SubnetSolveTask::execute(Real time,
                                                          Int timeStepCount) {
-  auto rBlock =
-      mSolver.mRightSideVector.block(mSubnet.sysOff, 0, mSubnet.sysSize, 1);
-  rBlock.setZero();
-
+  mSubnet.rightVector.setZero();
   for (auto stamp : mSubnet.rightVectorStamps)
-    rBlock += *stamp;
+    mSubnet.rightVector += *stamp;
+  mSolver.mRightSideVector.block(mSubnet.sysOff, 0, mSubnet.sysSize, 1) =
+      mSubnet.rightVector;
 
   auto lBlock = (**mSolver.mOrigLeftSideVector)
                     .block(mSubnet.sysOff, 0, mSubnet.sysSize, 1);
   // Solve Y' * v' = I
-  lBlock = mSubnet.luFactorization.solve(rBlock);
+  lBlock = mSubnet.linearSolver->solve(mSubnet.rightVector);
 }
 
 template <typename VarType>
@@ -544,11 +584,12 @@ void DiakopticsSolver<VarType>::SolveTask::execute(Real time,
                                                    Int timeStepCount) {
   auto lBlock =
       mSolver.mLeftSideVector.block(mSubnet.sysOff, 0, mSubnet.sysSize, 1);
-  auto rBlock = (**mSolver.mMappedTearCurrents)
-                    .block(mSubnet.sysOff, 0, mSubnet.sysSize, 1);
+  mSubnet.mappedTearCurrents =
+      (**mSolver.mMappedTearCurrents)
+          .block(mSubnet.sysOff, 0, mSubnet.sysSize, 1);
   // Solve Y' * x = C * i
   // v = v' + x
-  lBlock += mSubnet.luFactorization.solve(rBlock);
+  lBlock += mSubnet.linearSolver->solve(mSubnet.mappedTearCurrents);
   **mSubnet.leftVector = lBlock;
 }
 
@@ -634,11 +675,15 @@ void DiakopticsSolver<Complex>::PostSolveTask::execute(Real time,
 }
 
 template <> void DiakopticsSolver<Real>::log(Real time, Int timeStepCount) {
+  if (mLogSuspended)
+    return;
   mLeftVectorLog->logEMTNodeValues(time, mLeftSideVector);
   mRightVectorLog->logEMTNodeValues(time, mRightSideVector);
 }
 
 template <> void DiakopticsSolver<Complex>::log(Real time, Int timeStepCount) {
+  if (mLogSuspended)
+    return;
   mLeftVectorLog->logPhasorNodeValues(time, mLeftSideVector);
   mRightVectorLog->logPhasorNodeValues(time, mRightSideVector);
 }
@@ -0,0 +1,72 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <algorithm>
+
+#include <dpsim/InMemoryDataLogger.h>
+
+using namespace DPsim;
+
+InMemoryDataLogger::InMemoryDataLogger(UInt downsampling)
+    : DataLoggerInterface(), mDownsampling(downsampling), mExpectedRows(0) {
+  if (mDownsampling == 0)
+    throw std::invalid_argument(
+        "InMemoryDataLogger: downsampling must be at least one");
+}
+
+InMemoryDataLogger::InMemoryDataLogger(Real finalTime, Real timeStep,
+                                       UInt downsampling)
+    : InMemoryDataLogger(downsampling) {
+  // The simulation logs the initial values in addition to every step
+  mExpectedRows =
+      static_cast<size_t>(finalTime / timeStep + 0.5) / mDownsampling + 2;
+}
+
+void InMemoryDataLogger::start() {
+  mColumns = resolveColumns("InMemoryDataLogger");
+  // The columns follow the order of the attribute names
+  mNames.assign(1, "time");
+  for (auto &it : mAttributes)
+    mNames.push_back(it.first);
+
+  mData.resize(mNames.size());
+  for (auto &column : mData) {
+    // Values shared with a caller stay with the previous run
+    if (column && column.use_count() == 1)
+      column->clear();
+    else
+      column = std::make_shared<std::vector<Real>>();
+    column->reserve(mExpectedRows);
+  }
+}
+
+void InMemoryDataLogger::log(Real time, Int timeStepCount) {
+  if (timeStepCount % mDownsampling != 0)
+    return;
+
+  mData[0]->push_back(time);
+  for (size_t i = 0; i < mColumns.size(); ++i)
+    mData[i + 1]->push_back(mColumns[i].value());
+}
+
+std::shared_ptr<const std::vector<Real>>
+InMemoryDataLogger::getSharedColumn(const String &name) const {
+  auto it = std::find(mNames.begin(), mNames.end(), name);
+  if (it == mNames.end())
+    throw std::invalid_argument("InMemoryDataLogger: Unknown column " + name);
+
+  return mData[it - mNames.begin()];
+}
+
+void InMemoryDataLogger::Step::execute(Real time, Int timeStepCount) {
+  mLogger.log(time, timeStepCount);
+}
+
+CPS::Task::Ptr InMemoryDataLogger::getTask() {
+  return std::make_shared<InMemoryDataLogger::Step>(*this);
+}
@@ -27,6 +27,83 @@ void Interface::addExport(CPS::AttributeBase::Ptr attr) {
   mExportAttrsDpsim.emplace_back(attr, 0);
 }
 
+void Interface::setImportDelay(UInt steps,
+                               ImportExtrapolation extrapolation) {
+  if (mOpened) {
+    SPDLOG_LOGGER_ERROR(
+        mLog, "Cannot modify interface configuration after simulation start!");
+    std::exit(1);
+  }
+
+  mImportDelay = steps;
+  mImportExtrapolation = extrapolation;
+}
+
+void Interface::setImportPredictor(
+    InterfaceFramePredictor::Function predictor) {
+  if (mOpened) {
+    SPDLOG_LOGGER_ERROR(
+        mLog, "Cannot modify interface configuration after simulation start!");
+    std::exit(1);
+  }
+
+  mImportPredictorFunction = predictor;
+}
+
+void Interface::initImportDelay(const InterfaceFrameLayout &importLayout) {
+  mDelayedImports = 0;
+  if (mImportDelay == 0)
+    return;
+
+  mImportPredictor.configure(importLayout, mImportExtrapolation, mImportDelay,
+                             mImportPredictorFunction);
+  SPDLOG_LOGGER_INFO(mLog,
+                     "Imports of interface {} are delayed by {} additional "
+                     "exchanges",
+                     mName, mImportDelay);
+}
+
+void Interface::setRoundTripProbe(CPS::Attribute<Int>::Ptr sequence,
+                                  CPS::Attribute<Int>::Ptr echo) {
+  if (mOpened) {
+    SPDLOG_LOGGER_ERROR(
+        mLog, "Cannot modify interface configuration after simulation start!");
+    std::exit(1);
+  }
+
+  mProbeSequence = sequence;
+  mProbeEcho = echo;
+  mProbeSendTimes.fill({0, 0});
+  mProbeCounter = 0;
+  mLastProbeEcho = 0;
+}
+
+void Interface::stampRoundTripProbe() {
+  if (mProbeSequence.isNull())
+    return;
+
+  mProbeCounter++;
+  mProbeSequence->set(mProbeCounter);
+  mProbeSendTimes[mProbeCounter % mProbeSendTimes.size()] = {
+      mProbeCounter, LatencyHistogram::now()};
+}
+
+void Interface::checkRoundTripProbe() {
+  if (mProbeEcho.isNull())
+    return;
+
+  Int echo = mProbeEcho->get();
+  if (echo == mLastProbeEcho)
+    return;
+  mLastProbeEcho = echo;
+
+  // Values older than the send time buffer are not measured
+  const auto &[sequence, sendTime] =
+      mProbeSendTimes[static_cast<UInt>(echo) % mProbeSendTimes.size()];
+  if (sequence == echo)
+    mStatistics.roundTrip.recordSince(sendTime);
+}
+
 void Interface::setLogger(CPS::Logger::Log log) { mLog = log; }
 
 } // namespace DPsim
@@ -0,0 +1,267 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <dpsim/InterfaceFrame.h>
+
+using namespace CPS;
+using namespace DPsim;
+
+void InterfaceFrameLayout::addAttribute(AttributeBase &attr) {
+  const std::type_info &type = attr.getType();
+  Slot slot{ValueType::Real, mFrameSize, 1, 1};
+  UInt size = 1;
+
+  if (type == typeid(Real)) {
+    slot.type = ValueType::Real;
+  } else if (type == typeid(Int)) {
+    slot.type = ValueType::Int;
+  } else if (type == typeid(Bool)) {
+    slot.type = ValueType::Bool;
+  } else if (type == typeid(Complex)) {
+    slot.type = ValueType::Complex;
+    size = 2;
+  } else if (type == typeid(Matrix)) {
+    const Matrix &value = static_cast<Attribute<Matrix> &>(attr).get();
+    slot.type = ValueType::Matrix;
+    slot.rows = static_cast<UInt>(value.rows());
+    slot.cols = static_cast<UInt>(value.cols());
+    size = slot.rows * slot.cols;
+  } else if (type == typeid(MatrixComp)) {
+    const MatrixComp &value = static_cast<Attribute<MatrixComp> &>(attr).get();
+    slot.type = ValueType::MatrixComp;
+    slot.rows = static_cast<UInt>(value.rows());
+    slot.cols = static_cast<UInt>(value.cols());
+    size = 2 * slot.rows * slot.cols;
+  } else {
+    throw TypeException();
+  }
+
+  mSlots.push_back(slot);
+  mFrameSize += size;
+}
+
+InterfaceFrame InterfaceFrameLayout::makeFrame() const {
+  InterfaceFrame frame;
+  frame.data.assign(mFrameSize, 0);
+  frame.updated.assign(mSlots.size(), 0);
+  return frame;
+}
+
+void InterfaceFrameLayout::pack(UInt index, AttributeBase &attr,
+                                Real *data) const {
+  const Slot &slot = mSlots[index];
+  Real *dst = data + slot.offset;
+
+  // The slot type was derived from getType(), so the static casts are safe
+  switch (slot.type) {
+  case ValueType::Real:
+    *dst = static_cast<Attribute<Real> &>(attr).get();
+    break;
+  case ValueType::Int:
+    *dst = static_cast<Attribute<Int> &>(attr).get();
+    break;
+  case ValueType::Bool:
+    *dst = static_cast<Attribute<Bool> &>(attr).get() ? 1 : 0;
+    break;
+  case ValueType::Complex: {
+    const Complex &value = static_cast<Attribute<Complex> &>(attr).get();
+    dst[0] = value.real();
+    dst[1] = value.imag();
+    break;
+  }
+  case ValueType::Matrix: {
+    const Matrix &value = static_cast<Attribute<Matrix> &>(attr).get();
+    std::copy_n(value.data(), slot.rows * slot.cols, dst);
+    break;
+  }
+  case ValueType::MatrixComp: {
+    const MatrixComp &value = static_cast<Attribute<MatrixComp> &>(attr).get();
+    const Real *src = reinterpret_cast<const Real *>(value.data());
+    std::copy_n(src, 2 * slot.rows * slot.cols, dst);
+    break;
+  }
+  }
+}
+
+bool InterfaceFrameLayout::unpack(UInt index, const Real *data,
+                                  AttributeBase &attr) const {
+  const Slot &slot = mSlots[index];
+  const Real *src = data + slot.offset;
+
+  switch (slot.type) {
+  case ValueType::Real:
+    static_cast<Attribute<Real> &>(attr).set(*src);
+    break;
+  case ValueType::Int:
+    static_cast<Attribute<Int> &>(attr).set(static_cast<Int>(*src));
+    break;
+  case ValueType::Bool:
+    static_cast<Attribute<Bool> &>(attr).set(*src != 0);
+    break;
+  case ValueType::Complex:
+    static_cast<Attribute<Complex> &>(attr).set(Complex(src[0], src[1]));
+    break;
+  case ValueType::Matrix: {
+    auto &typed = static_cast<Attribute<Matrix> &>(attr);
+    Eigen::Map<const Matrix> value(src, slot.rows, slot.cols);
+    // Overwritten in place to avoid an allocation. For dynamic attributes
+    // this writes to the referenced storage, UPDATE_ON_SET tasks do not run.
+    Matrix &dst = typed.get();
+    if (dst.rows() != slot.rows || dst.cols() != slot.cols)
+      return false;
+    dst = value;
+    break;
+  }
+  case ValueType::MatrixComp: {
+    auto &typed = static_cast<Attribute<MatrixComp> &>(attr);
+    Eigen::Map<const MatrixComp> value(reinterpret_cast<const Complex *>(src),
+                                       slot.rows, slot.cols);
+    MatrixComp &dst = typed.get();
+    if (dst.rows() != slot.rows || dst.cols() != slot.cols)
+      return false;
+    dst = value;
+    break;
+  }
+  }
+  return true;
+}
+
+UInt InterfaceFrameLayout::signature() const {
+  // FNV-1a over type and size of each slot
+  UInt hash = 2166136261u;
+  auto add = [&hash](UInt value) {
+    for (int i = 0; i < 4; i++) {
+      hash ^= (value >> (8 * i)) & 0xff;
+      hash *= 16777619u;
+    }
+  };
+  for (const auto &slot : mSlots) {
+    add(static_cast<UInt>(slot.type));
+    add(slot.rows);
+    add(slot.cols);
+  }
+  return hash;
+}
+
+InterfaceFrameRing::InterfaceFrameRing(UInt numFrames,
+                                       const InterfaceFrameLayout &layout)
+    : mFilled(numFrames + 1), mFree(numFrames) {
+  mFrames.reserve(numFrames);
+  for (UInt i = 0; i < numFrames; i++) {
+    mFrames.push_back(layout.makeFrame());
+    mFree.enqueue(i);
+  }
+}
+
+InterfaceFrame *InterfaceFrameRing::frameFromIndex(UInt index) {
+  if (index >= mFrames.size()) {
+    // Close marker
+    mClosed = true;
+    return nullptr;
+  }
+  return &mFrames[index];
+}
+
+InterfaceFrame *InterfaceFrameRing::acquire() {
+  UInt index;
+  if (!mFree.try_dequeue(index))
+    return nullptr;
+  return &mFrames[index];
+}
+
+void InterfaceFrameRing::publish(InterfaceFrame *frame) {
+  mFilled.enqueue(static_cast<UInt>(frame - mFrames.data()));
+}
+
+void InterfaceFrameRing::close() {
+  mFilled.enqueue(static_cast<UInt>(mFrames.size()));
+}
+
+InterfaceFrame *InterfaceFrameRing::waitPop() {
+  if (mClosed)
+    return nullptr;
+  UInt index;
+  mFilled.wait_dequeue(index);
+  return frameFromIndex(index);
+}
+
+InterfaceFrame *InterfaceFrameRing::tryPop() {
+  UInt index;
+  if (mClosed || !mFilled.try_dequeue(index))
+    return nullptr;
+  return frameFromIndex(index);
+}
+
+void InterfaceFrameRing::release(InterfaceFrame *frame) {
+  std::fill(frame->updated.begin(), frame->updated.end(), 0);
+  mFree.enqueue(static_cast<UInt>(frame - mFrames.data()));
+}
+
+void InterfaceFramePredictor::configure(const InterfaceFrameLayout &layout,
+                                        ImportExtrapolation mode, UInt steps,
+                                        Function function) {
+  if (mode == ImportExtrapolation::Custom && !function)
+    throw std::invalid_argument("Custom import extrapolation needs a "
+                                "predictor function");
+  mLayout = layout;
+  mMode = mode;
+  mSteps = steps;
+  mFunction = function;
+  mNewest.assign(layout.frameSize(), 0);
+  mPrevious.assign(layout.frameSize(), 0);
+  mPrediction = layout.makeFrame();
+  std::fill(mPrediction.updated.begin(), mPrediction.updated.end(), 0);
+  mNumReceived = 0;
+}
+
+void InterfaceFramePredictor::push(const Real *values,
+                                   const unsigned char *updated) {
+  mPrevious.swap(mNewest);
+  if (mNumReceived > 0)
+    mNewest = mPrevious;
+  for (UInt i = 0; i < mLayout.numAttributes(); i++) {
+    if (updated && !updated[i])
+      continue;
+    UInt offset = mLayout.slots()[i].offset;
+    std::copy(values + offset, values + offset + mLayout.slotSize(i),
+              mNewest.begin() + offset);
+    mPrediction.updated[i] = 1;
+  }
+  // Without a previous frame, extrapolation starts from a constant value
+  if (mNumReceived == 0)
+    mPrevious = mNewest;
+  mNumReceived++;
+}
+
+const InterfaceFrame &InterfaceFramePredictor::predict() {
+  switch (mMode) {
+  case ImportExtrapolation::Hold:
+    mPrediction.data = mNewest;
+    break;
+  case ImportExtrapolation::Linear:
+    for (UInt i = 0; i < mLayout.numAttributes(); i++) {
+      const auto &slot = mLayout.slots()[i];
+      UInt end = slot.offset + mLayout.slotSize(i);
+      bool discrete = slot.type == InterfaceFrameLayout::ValueType::Int ||
+                      slot.type == InterfaceFrameLayout::ValueType::Bool;
+      for (UInt k = slot.offset; k < end; k++) {
+        mPrediction.data[k] =
+            discrete ? mNewest[k]
+                     : mNewest[k] + mSteps * (mNewest[k] - mPrevious[k]);
+      }
+    }
+    break;
+  case ImportExtrapolation::Custom:
+    mFunction(mLayout, mNewest, mPrevious, mSteps, mPrediction.data);
+    break;
+  }
+  return mPrediction;
+}
@@ -3,6 +3,8 @@
  * SPDX-License-Identifier: MPL-2.0
  */
 
+#include <algorithm>
+
 #include <dpsim/InterfaceQueued.h>
 #include <dpsim/InterfaceWorker.h>
 
@@ -11,23 +13,41 @@ using namespace CPS;
 namespace DPsim {
 
 void InterfaceQueued::open() {
+  mImportLayout = InterfaceFrameLayout();
+  for (auto &[attr, _seqId, _blockOnRead, _syncOnStart] : mImportAttrsDpsim)
+    mImportLayout.addAttribute(*attr);
+  mExportLayout = InterfaceFrameLayout();
+  for (auto &[attr, _seqId] : mExportAttrsDpsim)
+    mExportLayout.addAttribute(*attr);
+  mRingInterfaceToDpsim =
+      std::make_shared<InterfaceFrameRing>(mNumFrames, mImportLayout);
+  mRingDpsimToInterface =
+      std::make_shared<InterfaceFrameRing>(mNumFrames, mExportLayout);
+
+  mStatistics.reset();
+  initImportDelay(mImportLayout);
+  if (mImportDelay >= mNumFrames)
+    SPDLOG_LOGGER_WARN(mLog, "Import delay of {} steps exceeds the {} frames "
+                             "buffered by the interface",
+                       mImportDelay, mNumFrames);
+  mInterfaceWorker->setFrameLayouts(mImportLayout, mExportLayout);
   mInterfaceWorker->open();
   mOpened = true;
 
   if (!mImportAttrsDpsim.empty()) {
     mInterfaceReaderThread = std::thread(InterfaceQueued::ReaderThread(
-        mQueueInterfaceToDpsim, mInterfaceWorker, mOpened));
+        mRingInterfaceToDpsim, mImportLayout, mInterfaceWorker, mOpened,
+        mStatistics, mLog));
   }
   if (!mExportAttrsDpsim.empty()) {
     mInterfaceWriterThread = std::thread(InterfaceQueued::WriterThread(
-        mQueueDpsimToInterface, mInterfaceWorker));
+        mRingDpsimToInterface, mInterfaceWorker, mStatistics));
   }
 }
 
 void InterfaceQueued::close() {
   mOpened = false;
-  mQueueDpsimToInterface->emplace(AttributePacket{
-      nullptr, 0, 0, AttributePacketFlags::PACKET_CLOSE_INTERFACE});
+  mRingDpsimToInterface->close();
 
   if (!mExportAttrsDpsim.empty()) {
     mInterfaceWriterThread.join();
@@ -37,6 +57,7 @@ void InterfaceQueued::close() {
     mInterfaceReaderThread.join();
   }
   mInterfaceWorker->close();
+  mStatistics.log(mLog, mName);
 }
 
 CPS::Task::List InterfaceQueued::getTasks() {
@@ -77,15 +98,60 @@ void InterfaceQueued::syncExports() {
   this->pushDpsimAttrsToQueue();
 }
 
+void InterfaceQueued::applyImportFrame(const InterfaceFrame &frame) {
+  mStatistics.importApply.recordSince(frame.timestamp);
+  for (UInt i = 0; i < mImportAttrsDpsim.size(); i++) {
+    if (!frame.updated[i])
+      continue;
+    if (!mImportLayout.unpack(i, frame, *std::get<0>(mImportAttrsDpsim[i]))) {
+      SPDLOG_LOGGER_WARN(
+          mLog, "Failed to copy received value onto attribute in Interface!");
+    }
+    std::get<1>(mImportAttrsDpsim[i]) = frame.sequenceId;
+  }
+  mNextSequenceInterfaceToDpsim = frame.sequenceId + 1;
+}
+
+void InterfaceQueued::popDelayedImports() {
+  // The first exchanges only fill the pipeline, the values received during
+  // the synchronization stay applied
+  if (mDelayedImports < mImportDelay) {
+    mDelayedImports++;
+    return;
+  }
+
+  bool block = std::any_of(mImportAttrsDpsim.cbegin(), mImportAttrsDpsim.cend(),
+                           [](const auto &attrTuple) {
+                             return std::get<2>(attrTuple);
+                           });
+  InterfaceFrame *frame = block ? mRingInterfaceToDpsim->waitPop()
+                                : mRingInterfaceToDpsim->tryPop();
+  if (frame == nullptr)
+    return;
+
+  if (extrapolatesImports()) {
+    mImportPredictor.push(*frame);
+    applyImportFrame(mImportPredictor.predict());
+  } else {
+    applyImportFrame(*frame);
+  }
+  mRingInterfaceToDpsim->release(frame);
+  checkRoundTripProbe();
+}
+
 void InterfaceQueued::popDpsimAttrsFromQueue(bool isSync) {
-  AttributePacket receivedPacket = {nullptr, 0, 0,
-                                    AttributePacketFlags::PACKET_NO_FLAGS};
+  if (mImportDelay > 0 && !isSync) {
+    popDelayedImports();
+    return;
+  }
+
   UInt currentSequenceId = mNextSequenceInterfaceToDpsim;
+  InterfaceFrame *frame = nullptr;
 
-  // Wait for and dequeue all attributes that read should block on
+  // Wait for and apply frames until all attributes that read should block on are updated
   // The std::find_if will look for all attributes that have not been updated in the current while loop (i. e. whose sequence ID is lower than the next expected sequence ID)
   while (std::find_if(mImportAttrsDpsim.cbegin(), mImportAttrsDpsim.cend(),
-                      [currentSequenceId, isSync](auto attrTuple) {
+                      [currentSequenceId, isSync](const auto &attrTuple) {
                         auto &[_attr, seqId, blockOnRead, syncOnStart] =
                             attrTuple;
                         if (isSync) {
@@ -94,85 +160,96 @@ void InterfaceQueued::popDpsimAttrsFromQueue(bool isSync) {
                           return blockOnRead && seqId < currentSequenceId;
                         }
                       }) != mImportAttrsDpsim.cend()) {
-    if (mQueueInterfaceToDpsim->try_dequeue(receivedPacket) != false) {
-      int i = 0;
-      while (mQueueInterfaceToDpsim->try_dequeue(receivedPacket)) {
-        i++;
-      }
-      SPDLOG_LOGGER_WARN(mLog,
-                         "Overrun detected! Discarding {} overrun packets!", i);
-    } else {
-      mQueueInterfaceToDpsim->wait_dequeue(receivedPacket);
-    }
-    if (!std::get<0>(mImportAttrsDpsim[receivedPacket.attributeId])
-             ->copyValue(receivedPacket.value)) {
-      SPDLOG_LOGGER_WARN(
-          mLog, "Failed to copy received value onto attribute in Interface!");
-    }
-    std::get<1>(mImportAttrsDpsim[receivedPacket.attributeId]) =
-        receivedPacket.sequenceId;
-    mNextSequenceInterfaceToDpsim = receivedPacket.sequenceId + 1;
+    frame = mRingInterfaceToDpsim->waitPop();
+    if (extrapolatesImports())
+      mImportPredictor.push(*frame);
+    applyImportFrame(*frame);
+    mRingInterfaceToDpsim->release(frame);
   }
 
-  // Fetch all remaining queue packets
-  while (mQueueInterfaceToDpsim->try_dequeue(receivedPacket)) {
-    if (!std::get<0>(mImportAttrsDpsim[receivedPacket.attributeId])
-             ->copyValue(receivedPacket.value)) {
-      SPDLOG_LOGGER_WARN(
-          mLog, "Failed to copy received value onto attribute in Interface!");
-    }
-    std::get<1>(mImportAttrsDpsim[receivedPacket.attributeId]) =
-        receivedPacket.sequenceId;
-    mNextSequenceInterfaceToDpsim = receivedPacket.sequenceId + 1;
+  // Apply all remaining frames in order, so that values which are only
+  // present in older frames are not lost
+  UInt numFrames = 0;
+  while ((frame = mRingInterfaceToDpsim->tryPop()) != nullptr) {
+    if (extrapolatesImports())
+      mImportPredictor.push(*frame);
+    applyImportFrame(*frame);
+    mRingInterfaceToDpsim->release(frame);
+    numFrames++;
   }
+  if (numFrames > 1) {
+    mStatistics.importOverruns++;
+    SPDLOG_LOGGER_DEBUG(mLog,
+                        "Overrun detected! {} frames received in one step",
+                        numFrames);
+  }
+  checkRoundTripProbe();
 }
 
 void InterfaceQueued::pushDpsimAttrsToQueue() {
+  uint64_t stepEnd = LatencyHistogram::now();
+  InterfaceFrame *frame = mRingDpsimToInterface->acquire();
+  if (frame == nullptr) {
+    mStatistics.droppedExports++;
+    SPDLOG_LOGGER_WARN(mLog, "Interface thread does not keep up, dropping "
+                             "exported values of this step!");
+    return;
+  }
+
+  stampRoundTripProbe();
+  frame->sequenceId = mCurrentSequenceDpsimToInterface;
+  frame->timestamp = stepEnd;
   for (UInt i = 0; i < mExportAttrsDpsim.size(); i++) {
-    mQueueDpsimToInterface->emplace(AttributePacket{
-        std::get<0>(mExportAttrsDpsim[i])->cloneValueOntoNewAttribute(), i,
-        std::get<1>(mExportAttrsDpsim[i]),
-        AttributePacketFlags::PACKET_NO_FLAGS});
+    mExportLayout.pack(i, *std::get<0>(mExportAttrsDpsim[i]), *frame);
+    frame->updated[i] = 1;
     std::get<1>(mExportAttrsDpsim[i]) = mCurrentSequenceDpsimToInterface;
-    mCurrentSequenceDpsimToInterface++;
   }
+  mCurrentSequenceDpsimToInterface++;
+  mRingDpsimToInterface->publish(frame);
 }
 
 void InterfaceQueued::WriterThread::operator()() const {
-  bool interfaceClosed = false;
-  std::vector<InterfaceQueued::AttributePacket> attrsToWrite;
-  while (!interfaceClosed) {
-    AttributePacket nextPacket = {nullptr, 0, 0,
-                                  AttributePacketFlags::PACKET_NO_FLAGS};
-
-    // Wait for at least one packet
-    mQueueDpsimToInterface->wait_dequeue(nextPacket);
-    if (nextPacket.flags & AttributePacketFlags::PACKET_CLOSE_INTERFACE) {
-      interfaceClosed = true;
-    } else {
-      attrsToWrite.push_back(nextPacket);
+  InterfaceFrame *frame;
+  while ((frame = mRingDpsimToInterface->waitPop()) != nullptr) {
+    mStatistics.exportDequeue.recordSince(frame->timestamp);
+    // Frames always hold all exports, so only the latest one is written
+    InterfaceFrame *next;
+    while ((next = mRingDpsimToInterface->tryPop()) != nullptr) {
+      mStatistics.exportDequeue.recordSince(next->timestamp);
+      mRingDpsimToInterface->release(frame);
+      frame = next;
     }
-
-    // See if there are more packets
-    while (mQueueDpsimToInterface->try_dequeue(nextPacket)) {
-      if (nextPacket.flags & AttributePacketFlags::PACKET_CLOSE_INTERFACE) {
-        interfaceClosed = true;
-      } else {
-        attrsToWrite.push_back(nextPacket);
-      }
-    }
-    mInterfaceWorker->writeValuesToEnv(attrsToWrite);
+    mInterfaceWorker->writeValuesToEnv(*frame);
+    mStatistics.exportHandoff.recordSince(frame->timestamp);
+    mRingDpsimToInterface->release(frame);
   }
 }
 
 void InterfaceQueued::ReaderThread::operator()() const {
-  std::vector<InterfaceQueued::AttributePacket> attrsRead;
+  // Values read while all frames are in use end up here and are dropped
+  InterfaceFrame overflow = mLayout.makeFrame();
+  InterfaceFrame *frame = nullptr;
+  UInt sequenceId = 1;
   while (mOpened) {
-    mInterfaceWorker->readValuesFromEnv(attrsRead);
-    for (const auto &packet : attrsRead) {
-      mQueueInterfaceToDpsim->enqueue(packet);
+    if (frame == nullptr || frame == &overflow) {
+      frame = mRingInterfaceToDpsim->acquire();
+      if (frame == nullptr)
+        frame = &overflow;
+    }
+    if (!mInterfaceWorker->readValuesFromEnv(*frame))
+      continue;
+
+    if (frame == &overflow) {
+      mStatistics.droppedImports++;
+      SPDLOG_LOGGER_WARN(mLog, "Simulation does not keep up, dropping "
+                               "imported values!");
+      std::fill(overflow.updated.begin(), overflow.updated.end(), 0);
+      continue;
     }
-    attrsRead.clear();
+    frame->sequenceId = sequenceId++;
+    frame->timestamp = LatencyHistogram::now();
+    mRingInterfaceToDpsim->publish(frame);
+    frame = nullptr;
   }
 }
 
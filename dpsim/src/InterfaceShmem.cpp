@@ -0,0 +1,408 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <dpsim/InterfaceShmem.h>
+
+using namespace CPS;
+using namespace DPsim;
+
+namespace {
+constexpr size_t cacheLine = 64;
+constexpr uint32_t ringMagic = 0x4450534d; // "DPSM"
+constexpr uint32_t ringVersion = 2;
+/// Polls of the ring position before a reader sleeps on the futex or, when
+/// busy polling, starts yielding the CPU between polls
+constexpr UInt futexSpinCount = 2000;
+
+struct FrameHeader {
+  uint64_t sequence;
+  /// When the frame was written, see LatencyHistogram::now
+  uint64_t timestamp;
+
+  Real *values() { return reinterpret_cast<Real *>(this + 1); }
+};
+
+inline void cpuRelax() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#endif
+}
+
+void futexWait(std::atomic<uint32_t> *word, uint32_t expected) {
+  // Time out regularly, so that a missed wake-up only costs latency
+  struct timespec timeout = {0, 100000000};
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(word), FUTEX_WAIT, expected,
+          &timeout, nullptr, 0);
+}
+
+void futexWake(std::atomic<uint32_t> *word) {
+  syscall(SYS_futex, reinterpret_cast<uint32_t *>(word), FUTEX_WAKE, 1,
+          nullptr, nullptr, 0);
+}
+} // namespace
+
+/// Control block at the start of each shared memory object, followed by the
+/// frames. Writer and reader positions are on separate cache lines.
+struct InterfaceShmem::Ring {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t numFrames;
+  /// Number of Reals per frame and distance between frames in bytes
+  uint32_t frameSize;
+  uint32_t frameBytes;
+  uint32_t signature;
+  /// Set by the creator once the ring is initialized
+  std::atomic<uint32_t> ready;
+  std::atomic<uint32_t> closed;
+
+  /// Frames written by the producer
+  alignas(cacheLine) std::atomic<uint64_t> head;
+  /// Frames consumed by the reader
+  alignas(cacheLine) std::atomic<uint64_t> tail;
+  /// Futex word incremented for each wake-up, and whether the reader sleeps
+  alignas(cacheLine) std::atomic<uint32_t> wakeup;
+  std::atomic<uint32_t> sleeping;
+
+  FrameHeader *frame(uint64_t position) {
+    char *frames = reinterpret_cast<char *>(this) + sizeof(Ring);
+    return reinterpret_cast<FrameHeader *>(frames + (position % numFrames) *
+                                                        frameBytes);
+  }
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "Shared memory rings need address-free atomics");
+
+static size_t frameBytesFor(const InterfaceFrameLayout &layout) {
+  size_t bytes = sizeof(FrameHeader) + layout.frameSize() * sizeof(Real);
+  return (bytes + cacheLine - 1) / cacheLine * cacheLine;
+}
+
+InterfaceShmem::InterfaceShmem(const String &exportName,
+                               const String &importName, const String &name,
+                               UInt numFrames, WaitMode waitMode,
+                               spdlog::level::level_enum logLevel)
+    : Interface(name, logLevel), mExportName(exportName),
+      mImportName(importName), mNumFrames(numFrames), mWaitMode(waitMode) {}
+
+InterfaceShmem::~InterfaceShmem() {
+  if (mOpened) {
+    try {
+      close();
+    } catch (const std::exception &e) {
+      SPDLOG_LOGGER_ERROR(mLog, "Error closing interface: {}", e.what());
+    }
+  }
+}
+
+InterfaceShmem::Ring *
+InterfaceShmem::createRing(const String &shmName,
+                           const InterfaceFrameLayout &layout, size_t &bytes) {
+  static_assert(sizeof(Ring) % cacheLine == 0,
+                "Frames must start on a cache line");
+  size_t frameBytes = frameBytesFor(layout);
+  bytes = sizeof(Ring) + mNumFrames * frameBytes;
+
+  // Remove a ring left over from an earlier run
+  shm_unlink(shmName.c_str());
+  int fd = shm_open(shmName.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd < 0)
+    throw SystemError("Failed to create shared memory object " + shmName);
+  if (ftruncate(fd, static_cast<off_t>(bytes)) < 0) {
+    ::close(fd);
+    throw SystemError("Failed to resize shared memory object " + shmName);
+  }
+  void *addr =
+      mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (addr == MAP_FAILED)
+    throw SystemError("Failed to map shared memory object " + shmName);
+
+  Ring *ring = new (addr) Ring();
+  ring->magic = ringMagic;
+  ring->version = ringVersion;
+  ring->numFrames = mNumFrames;
+  ring->frameSize = layout.frameSize();
+  ring->frameBytes = static_cast<uint32_t>(frameBytes);
+  ring->signature = layout.signature();
+  ring->closed.store(0);
+  ring->head.store(0);
+  ring->tail.store(0);
+  ring->wakeup.store(0);
+  ring->sleeping.store(0);
+  ring->ready.store(1, std::memory_order_release);
+  return ring;
+}
+
+InterfaceShmem::Ring *
+InterfaceShmem::openRing(const String &shmName,
+                         const InterfaceFrameLayout &layout, size_t &bytes) {
+  auto deadline = std::chrono::steady_clock::now() +
+                  std::chrono::duration<Real>(mOpenTimeout);
+
+  // The peer might not have created its ring yet
+  while (true) {
+    int fd = shm_open(shmName.c_str(), O_RDWR, 0);
+    if (fd >= 0) {
+      struct stat st;
+      if (fstat(fd, &st) == 0 && st.st_size >= (off_t)sizeof(Ring)) {
+        bytes = static_cast<size_t>(st.st_size);
+        void *addr =
+            mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (addr == MAP_FAILED)
+          throw SystemError("Failed to map shared memory object " + shmName);
+
+        Ring *ring = static_cast<Ring *>(addr);
+        // A closed ring is left over from an earlier run of the peer
+        if (ring->ready.load(std::memory_order_acquire) &&
+            !ring->closed.load()) {
+          if (ring->magic != ringMagic || ring->version != ringVersion)
+            throw std::runtime_error(shmName + " is not a DPsim interface");
+          if (ring->frameSize != layout.frameSize() ||
+              ring->signature != layout.signature())
+            throw std::runtime_error(
+                "Exports of the peer do not match the imports configured for " +
+                shmName);
+          return ring;
+        }
+        munmap(addr, bytes);
+      } else {
+        ::close(fd);
+      }
+    }
+
+    if (std::chrono::steady_clock::now() > deadline)
+      throw std::runtime_error("Timeout while waiting for peer to create " +
+                               shmName);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+}
+
+void InterfaceShmem::open() {
+  mImportLayout = InterfaceFrameLayout();
+  mBlockOnRead = false;
+  for (auto &[attr, _seqId, blockOnRead, _syncOnStart] : mImportAttrsDpsim) {
+    mImportLayout.addAttribute(*attr);
+    mBlockOnRead |= blockOnRead;
+  }
+  mExportLayout = InterfaceFrameLayout();
+  for (auto &[attr, _seqId] : mExportAttrsDpsim)
+    mExportLayout.addAttribute(*attr);
+
+  // Create the own ring first, so that two peers opening at the same time
+  // find each other
+  if (!mExportAttrsDpsim.empty())
+    mExportRing = createRing(mExportName, mExportLayout, mExportRingBytes);
+  if (!mImportAttrsDpsim.empty())
+    mImportRing = openRing(mImportName, mImportLayout, mImportRingBytes);
+
+  mSequenceDpsimToPeer = 1;
+  mLastImportSequence = 0;
+  mDroppedFrames = 0;
+  mStatistics.reset();
+  initImportDelay(mImportLayout);
+  // The peer stays up to the delay plus the frames of the synchronization
+  // ahead
+  if (mImportRing && mImportDelay + 2 >= mImportRing->numFrames)
+    SPDLOG_LOGGER_WARN(mLog, "Import delay of {} steps exceeds the {} frames "
+                             "of {}",
+                       mImportDelay, mImportRing->numFrames, mImportName);
+  mOpened = true;
+  SPDLOG_LOGGER_INFO(mLog, "Opened shared memory interface, {} exports to {}, "
+                           "{} imports from {}",
+                     mExportAttrsDpsim.size(), mExportName,
+                     mImportAttrsDpsim.size(), mImportName);
+}
+
+void InterfaceShmem::close() {
+  if (mExportRing) {
+    mExportRing->closed.store(1, std::memory_order_release);
+    mExportRing->wakeup.fetch_add(1);
+    futexWake(&mExportRing->wakeup);
+    munmap(mExportRing, mExportRingBytes);
+    shm_unlink(mExportName.c_str());
+    mExportRing = nullptr;
+  }
+  if (mImportRing) {
+    munmap(mImportRing, mImportRingBytes);
+    mImportRing = nullptr;
+  }
+  if (mDroppedFrames > 0)
+    SPDLOG_LOGGER_WARN(mLog, "{} frames were dropped because the peer did not "
+                             "keep up",
+                       mDroppedFrames);
+  mStatistics.log(mLog, mName);
+  mOpened = false;
+}
+
+CPS::Task::List InterfaceShmem::getTasks() {
+  auto tasks = CPS::Task::List();
+  if (!mImportAttrsDpsim.empty())
+    tasks.push_back(std::make_shared<InterfaceShmem::PreStep>(*this));
+  if (!mExportAttrsDpsim.empty())
+    tasks.push_back(std::make_shared<InterfaceShmem::PostStep>(*this));
+  return tasks;
+}
+
+void InterfaceShmem::PreStep::execute(Real time, Int timeStepCount) {
+  if (mIntf.mImportDelay == 0) {
+    mIntf.readImports(mIntf.mBlockOnRead);
+  } else if (mIntf.mDelayedImports < mIntf.mImportDelay) {
+    // The first steps only fill the pipeline, the values received during
+    // the synchronization stay applied
+    mIntf.mDelayedImports++;
+  } else {
+    mIntf.readImports(mIntf.mBlockOnRead);
+  }
+}
+
+void InterfaceShmem::PostStep::execute(Real time, Int timeStepCount) {
+  mIntf.writeExports();
+}
+
+void InterfaceShmem::syncImports() {
+  bool sync = false;
+  for (const auto &[_attr, _seqId, _blockOnRead, syncOnStart] :
+       mImportAttrsDpsim)
+    sync |= syncOnStart;
+  readImports(sync);
+}
+
+void InterfaceShmem::syncExports() { writeExports(); }
+
+void InterfaceShmem::writeExports() {
+  if (!mExportRing)
+    return;
+  Ring &ring = *mExportRing;
+  uint64_t stepEnd = LatencyHistogram::now();
+
+  UInt sequence = mSequenceDpsimToPeer++;
+  uint64_t head = ring.head.load(std::memory_order_relaxed);
+  if (head - ring.tail.load(std::memory_order_acquire) >= ring.numFrames) {
+    // The reader sees the gap in the sequence numbers
+    mDroppedFrames++;
+    mStatistics.droppedExports++;
+    return;
+  }
+
+  stampRoundTripProbe();
+  FrameHeader *frame = ring.frame(head);
+  frame->sequence = sequence;
+  frame->timestamp = stepEnd;
+  for (UInt i = 0; i < mExportAttrsDpsim.size(); i++) {
+    mExportLayout.pack(i, *std::get<0>(mExportAttrsDpsim[i]), frame->values());
+    std::get<1>(mExportAttrsDpsim[i]) = sequence;
+  }
+
+  // Publishing and checking for a sleeping reader must not be reordered,
+  // see waitForFrame
+  ring.head.store(head + 1, std::memory_order_seq_cst);
+  if (ring.sleeping.load(std::memory_order_seq_cst)) {
+    ring.wakeup.fetch_add(1, std::memory_order_seq_cst);
+    futexWake(&ring.wakeup);
+  }
+  mStatistics.exportHandoff.recordSince(stepEnd);
+}
+
+bool InterfaceShmem::waitForFrame() {
+  Ring &ring = *mImportRing;
+  uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+
+  for (UInt spin = 0;; spin++) {
+    if (ring.head.load(std::memory_order_acquire) != tail)
+      return true;
+    if (ring.closed.load(std::memory_order_acquire))
+      return false;
+
+    if (mWaitMode == WaitMode::Futex && spin >= futexSpinCount) {
+      uint32_t wakeup = ring.wakeup.load(std::memory_order_seq_cst);
+      ring.sleeping.store(1, std::memory_order_seq_cst);
+      // Check again after announcing the sleep, the writer either sees the
+      // flag or its frame is visible here
+      if (ring.head.load(std::memory_order_seq_cst) == tail &&
+          !ring.closed.load(std::memory_order_seq_cst))
+        futexWait(&ring.wakeup, wakeup);
+      ring.sleeping.store(0, std::memory_order_relaxed);
+    } else if (spin >= futexSpinCount) {
+      // Let the peer run if both share a core
+      std::this_thread::yield();
+    } else {
+      cpuRelax();
+    }
+  }
+}
+
+bool InterfaceShmem::readImports(bool block) {
+  if (!mImportRing)
+    return true;
+  Ring &ring = *mImportRing;
+
+  if (block && !waitForFrame()) {
+    SPDLOG_LOGGER_WARN(mLog, "Peer closed {}, keeping the last imported values",
+                       mImportName);
+    return false;
+  }
+
+  uint64_t head = ring.head.load(std::memory_order_acquire);
+  uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+  if (head == tail)
+    return !ring.closed.load(std::memory_order_acquire);
+
+  // In lockstep every step consumes exactly one frame, so that both peers
+  // keep the lead of one frame they gain in the synchronization. Otherwise
+  // frames hold all imports and only the latest one is applied. The writer
+  // does not reuse a frame before the tail is advanced.
+  uint64_t position = block ? tail : head - 1;
+  if (!block && head - tail > 1)
+    mStatistics.importOverruns++;
+  FrameHeader *frame = ring.frame(position);
+  UInt sequence = static_cast<UInt>(frame->sequence);
+  if (sequence != mLastImportSequence + 1) {
+    SPDLOG_LOGGER_DEBUG(mLog, "Skipped {} frames from {}",
+                        sequence - mLastImportSequence - 1, mImportName);
+  }
+
+  const Real *values = frame->values();
+  if (extrapolatesImports()) {
+    mImportPredictor.push(values);
+    values = mImportPredictor.predict().data.data();
+  }
+
+  for (UInt i = 0; i < mImportAttrsDpsim.size(); i++) {
+    if (!mImportLayout.unpack(i, values,
+                              *std::get<0>(mImportAttrsDpsim[i]))) {
+      SPDLOG_LOGGER_WARN(
+          mLog, "Failed to copy received value onto attribute in Interface!");
+    }
+    std::get<1>(mImportAttrsDpsim[i]) = sequence;
+  }
+  mLastImportSequence = sequence;
+  mNextSequenceInterfaceToDpsim = sequence + 1;
+  // Both processes use the same monotonic clock, so this includes the time
+  // the frame waited in the ring
+  mStatistics.importApply.recordSince(frame->timestamp);
+  checkRoundTripProbe();
+
+  ring.tail.store(position + 1, std::memory_order_release);
+  return true;
+}
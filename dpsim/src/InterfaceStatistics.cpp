@@ -0,0 +1,39 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <dpsim/InterfaceStatistics.h>
+
+using namespace DPsim;
+
+void InterfaceStatistics::reset() {
+  exportHandoff.reset();
+  exportDequeue.reset();
+  importApply.reset();
+  roundTrip.reset();
+  importOverruns = 0;
+  droppedExports = 0;
+  droppedImports = 0;
+}
+
+void InterfaceStatistics::log(CPS::Logger::Log log, const String &name) const {
+  const std::pair<const char *, const LatencyHistogram *> histograms[] = {
+      {"export handoff", &exportHandoff},
+      {"export dequeue", &exportDequeue},
+      {"import apply", &importApply},
+      {"round trip", &roundTrip}};
+  for (const auto &[label, histogram] : histograms) {
+    if (histogram->count() > 0)
+      SPDLOG_LOGGER_INFO(log, "Interface {} {}: {}", name, label,
+                         histogram->summary());
+  }
+  SPDLOG_LOGGER_INFO(log,
+                     "Interface {}: {} import overruns, {} dropped exports, "
+                     "{} dropped imports",
+                     name, importOverruns.load(), droppedExports.load(),
+                     droppedImports.load());
+}
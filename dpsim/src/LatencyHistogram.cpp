@@ -0,0 +1,89 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <algorithm>
+
+#include <dpsim/LatencyHistogram.h>
+#include <spdlog/fmt/fmt.h>
+
+using namespace DPsim;
+
+UInt LatencyHistogram::bucketIndex(uint64_t nanoseconds) {
+  if (nanoseconds < subBuckets)
+    return static_cast<UInt>(nanoseconds);
+
+  // The two bits below the most significant one select the sub-bucket
+  UInt msb = 63 - __builtin_clzll(nanoseconds);
+  UInt sub = static_cast<UInt>(nanoseconds >> (msb - 2)) & (subBuckets - 1);
+  UInt index = (msb - 1) * subBuckets + sub;
+  return index < numBuckets ? index : numBuckets - 1;
+}
+
+uint64_t LatencyHistogram::bucketLowerBound(UInt bucket) {
+  if (bucket < subBuckets)
+    return bucket;
+
+  UInt msb = bucket / subBuckets + 1;
+  UInt sub = bucket % subBuckets;
+  return static_cast<uint64_t>(subBuckets + sub) << (msb - 2);
+}
+
+void LatencyHistogram::record(uint64_t nanoseconds) {
+  mBuckets[bucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+  mSum.fetch_add(nanoseconds, std::memory_order_relaxed);
+  // Only one thread records, so there is no race between load and store
+  if (nanoseconds < mMin.load(std::memory_order_relaxed))
+    mMin.store(nanoseconds, std::memory_order_relaxed);
+  if (nanoseconds > mMax.load(std::memory_order_relaxed))
+    mMax.store(nanoseconds, std::memory_order_relaxed);
+  mCount.fetch_add(1, std::memory_order_release);
+}
+
+void LatencyHistogram::reset() {
+  for (auto &bucket : mBuckets)
+    bucket.store(0, std::memory_order_relaxed);
+  mSum.store(0, std::memory_order_relaxed);
+  mMin.store(UINT64_MAX, std::memory_order_relaxed);
+  mMax.store(0, std::memory_order_relaxed);
+  mCount.store(0, std::memory_order_release);
+}
+
+uint64_t LatencyHistogram::min() const {
+  return count() > 0 ? mMin.load(std::memory_order_relaxed) : 0;
+}
+
+Real LatencyHistogram::mean() const {
+  uint64_t n = count();
+  return n > 0 ? static_cast<Real>(mSum.load(std::memory_order_relaxed)) / n
+               : 0;
+}
+
+uint64_t LatencyHistogram::quantile(Real q) const {
+  uint64_t n = count();
+  if (n == 0)
+    return 0;
+
+  uint64_t rank = static_cast<uint64_t>(q * (n - 1)) + 1;
+  uint64_t seen = 0;
+  for (UInt bucket = 0; bucket < numBuckets; bucket++) {
+    seen += bucketCount(bucket);
+    if (seen >= rank) {
+      if (bucket + 1 == numBuckets)
+        return max();
+      return std::min(bucketLowerBound(bucket + 1), max());
+    }
+  }
+  return max();
+}
+
+String LatencyHistogram::summary() const {
+  return fmt::format("n={} mean={:.1f}us p50<={:.1f}us p99<={:.1f}us "
+                     "max={:.1f}us",
+                     count(), mean() / 1e3, quantile(0.5) / 1e3,
+                     quantile(0.99) / 1e3, max() / 1e3);
+}
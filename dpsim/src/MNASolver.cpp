@@ -626,7 +626,7 @@ template <typename VarType> Task::List MnaSolver<VarType>::getTasks() {
 
 template <typename VarType>
 void MnaSolver<VarType>::log(Real time, Int timeStepCount) {
-  if (mLogLevel == Logger::Level::off)
+  if (mLogLevel == Logger::Level::off || mLogSuspended)
     return;
 
   if (mDomain == CPS::Domain::EMT) {
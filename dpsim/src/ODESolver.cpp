@@ -6,6 +6,8 @@
  * file, You can obtain one at https://mozilla.org/MPL/2.0/.
  *********************************************************************************/
 
+#include <cmath>
+
 #include <dpsim-models/SimPowerComp.h>
 #include <dpsim/ODESolver.h>
 
@@ -64,26 +66,14 @@ int ODESolver::Jacobian(realtype t, N_Vector y, N_Vector fy, SUNMatrix J,
   return 0;
 }
 
-Real ODESolver::step(Real initial_time) {
-  // Not absolutely necessary; realtype by default double (same as Real)
-  realtype T0 = (realtype)initial_time;
-  realtype Tf = (realtype)initial_time + mTimestep;
-
-  /// Number of integration steps
-  long int nst;
-  /// Number of error test fails
-  long int netf;
-
-  mComponent->mOdePostState->set(mComponent->mOdePreState->get());
-
-  // Better allocate the arkode memory here to prevent numerical problems
+void ODESolver::createIntegrator(Real initial_time) {
   mArkode_mem = ARKodeCreate();
   if (check_flag(mArkode_mem, "ARKodeCreate", 0))
-    mFlag = 1;
+    throw CPS::Exception();
 
   mFlag = ARKodeSetUserData(mArkode_mem, this);
   if (check_flag(&mFlag, "ARKodeSetUserData", 1))
-    mFlag = 1;
+    throw CPS::Exception();
 
   /* Call ARKodeInit to initialize the integrator memory and specify the
    * right-hand side function in y'=f(t,y), the inital time T0, and
@@ -123,7 +113,51 @@ Real ODESolver::step(Real initial_time) {
 
   mFlag = ARKodeSStolerances(mArkode_mem, reltol, abstol);
   if (check_flag(&mFlag, "ARKodeSStolerances", 1))
-    mFlag = 1;
+    throw CPS::Exception();
+
+  mIntegratorStarted = true;
+}
+
+void ODESolver::reinitialize(Real initial_time) {
+  // Drops the step size history but keeps the memory, matrix and linear
+  // solver attached to the integrator
+  if (mImplicitIntegration)
+    mFlag = ARKodeReInit(mArkode_mem, NULL, &ODESolver::StateSpaceWrapper,
+                         initial_time, mStates);
+  else
+    mFlag = ARKodeReInit(mArkode_mem, &ODESolver::StateSpaceWrapper, NULL,
+                         initial_time, mStates);
+  if (check_flag(&mFlag, "ARKodeReInit", 1))
+    throw CPS::Exception();
+  ++mNumReinits;
+}
+
+Real ODESolver::step(Real initial_time) {
+  // Not absolutely necessary; realtype by default double (same as Real)
+  realtype T0 = (realtype)initial_time;
+  realtype Tf = (realtype)initial_time + mTimestep;
+
+  // The integration only continues if the component passes on the state of
+  // the last step at the time the last step ended. Anything else, e.g. a
+  // state reset by an event, is a discontinuity. The simulation accumulates
+  // its time separately, so the times only agree up to round-off.
+  bool continuous =
+      mIntegratorStarted &&
+      std::abs(initial_time - mLastTime) < TIME_TOLERANCE * mTimestep &&
+      **mComponent->mOdePreState == mLastState;
+
+  mComponent->mOdePostState->set(mComponent->mOdePreState->get());
+
+  if (!mIntegratorStarted)
+    createIntegrator(initial_time);
+  else if (!continuous)
+    reinitialize(initial_time);
+
+  // The inputs of the component are only valid until the end of this step,
+  // so the integrator must not step beyond it
+  mFlag = ARKodeSetStopTime(mArkode_mem, Tf);
+  if (check_flag(&mFlag, "ARKodeSetStopTime", 1))
+    throw CPS::Exception();
 
   // Main integrator loop
   realtype t = T0;
@@ -133,20 +167,9 @@ Real ODESolver::step(Real initial_time) {
       break;
   }
 
-  // Get some statistics to check for numerical problems (instability, blow-up etc)
-  mFlag = ARKodeGetNumSteps(mArkode_mem, &nst);
-  if (check_flag(&mFlag, "ARKodeGetNumSteps", 1))
-    return 1;
-  mFlag = ARKodeGetNumErrTestFails(mArkode_mem, &netf);
-  if (check_flag(&mFlag, "ARKodeGetNumErrTestFails", 1))
-    return 1;
-
-  ARKodeFree(&mArkode_mem);
-  SUNLinSolFree(LS);
-  SUNMatDestroy(A);
+  mLastTime = Tf;
+  mLastState = **mComponent->mOdePostState;
 
-  // Print statistics:
-  //std::cout << "Number Computing Steps: "<< nst << " Number Error-Test-Fails: " << netf << std::endl;
   return Tf;
 }
 
@@ -193,4 +216,12 @@ int ODESolver::check_flag(void *flagvalue, const std::string &funcname,
   return 0;
 }
 
-ODESolver::~ODESolver() { N_VDestroy(mStates); }
+ODESolver::~ODESolver() {
+  if (mArkode_mem)
+    ARKodeFree(&mArkode_mem);
+  if (LS)
+    SUNLinSolFree(LS);
+  if (A)
+    SUNMatDestroy(A);
+  N_VDestroy(mStates);
+}
@@ -0,0 +1,229 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include <dpsim/PFContingencyAnalysis.h>
+
+using namespace DPsim;
+using namespace CPS;
+
+PFContingencyAnalysis::PFContingencyAnalysis(CPS::String name,
+                                             const CPS::SystemTopology &system,
+                                             CPS::Real timeStep,
+                                             CPS::Logger::Level logLevel)
+    : PFSolverPowerPolar(name, system, timeStep, logLevel) {}
+
+void PFContingencyAnalysis::collectBranches() {
+  mBranches.clear();
+
+  auto limit = [this](const String &name) {
+    auto it = mBranchLimits.find(name);
+    return it == mBranchLimits.end() ? 0. : it->second / mBaseApparentPower;
+  };
+
+  for (auto line : mLines)
+    mBranches.push_back({line->name(), line->node(0)->matrixNodeIndex(),
+                         line->node(1)->matrixNodeIndex(), line->Y_element(),
+                         limit(line->name())});
+  for (auto trafo : mTransformers) {
+    // Transformers that are not part of mY cannot be taken out of it
+    if (!isAdmittanceStamped(*trafo))
+      continue;
+    mBranches.push_back({trafo->name(), trafo->node(0)->matrixNodeIndex(),
+                         trafo->node(1)->matrixNodeIndex(), trafo->Y_element(),
+                         limit(trafo->name())});
+  }
+}
+
+void PFContingencyAnalysis::copyBaseCase(const PFContingencyAnalysis &base) {
+  Pesp = base.Pesp;
+  Qesp = base.Qesp;
+  mBaseV = base.mBaseV;
+  mBaseD = base.mBaseD;
+  mBranches = base.mBranches;
+  mMinVoltage = base.mMinVoltage;
+  mMaxVoltage = base.mMaxVoltage;
+}
+
+Bool PFContingencyAnalysis::isConnected() {
+  // Entries of an outaged branch only keep round-off errors
+  const Real threshold = 1e-9;
+  UInt numNodes = mSystem.mNodes.size();
+  std::vector<Bool> visited(numNodes, false);
+  std::vector<UInt> stack(mVDBusIndices.begin(), mVDBusIndices.end());
+  UInt numVisited = 0;
+
+  for (auto k : stack) {
+    visited[k] = true;
+    ++numVisited;
+  }
+  while (!stack.empty()) {
+    UInt k = stack.back();
+    stack.pop_back();
+    for (SparseMatrixCompRow::InnerIterator it(mY, k); it; ++it) {
+      UInt j = it.col();
+      if (visited[j] || std::abs(it.value()) < threshold)
+        continue;
+      visited[j] = true;
+      ++numVisited;
+      stack.push_back(j);
+    }
+  }
+  return numVisited == numNodes;
+}
+
+void PFContingencyAnalysis::checkLimits(UInt outage, Result &result) {
+  result.minVoltage = sol_V.minCoeff();
+  result.maxVoltage = sol_V.maxCoeff();
+
+  for (UInt k = 0; k < mSystem.mNodes.size(); ++k) {
+    if (sol_V.coeff(k) < mMinVoltage || sol_V.coeff(k) > mMaxVoltage)
+      result.violations.push_back(mSystem.mNodes[k]->name());
+  }
+
+  for (UInt b = 0; b < mBranches.size(); ++b) {
+    const Branch &branch = mBranches[b];
+    if (b == outage || branch.limit <= 0)
+      continue;
+    Complex vFrom = sol_Vcx(branch.from);
+    Complex vTo = sol_Vcx(branch.to);
+    Complex sFrom =
+        vFrom * std::conj(branch.y(0, 0) * vFrom + branch.y(0, 1) * vTo);
+    Complex sTo =
+        vTo * std::conj(branch.y(1, 0) * vFrom + branch.y(1, 1) * vTo);
+    if (std::max(std::abs(sFrom), std::abs(sTo)) > branch.limit)
+      result.violations.push_back(branch.name);
+  }
+}
+
+void PFContingencyAnalysis::evaluate(UInt outage, Result &result) {
+  auto start = std::chrono::steady_clock::now();
+  const Branch &branch = mBranches[outage];
+  result = Result();
+  result.branch = branch.name;
+
+  // Remove the branch stamp. The pattern of mY stays the same, so the
+  // symbolic analysis of the Jacobian remains valid.
+  UInt nodes[2] = {branch.from, branch.to};
+  Complex previous[2][2];
+  for (UInt a = 0; a < 2; ++a) {
+    for (UInt b = 0; b < 2; ++b) {
+      Complex &entry = mY.coeffRef(nodes[a], nodes[b]);
+      previous[a][b] = entry;
+      entry -= branch.y(a, b);
+    }
+  }
+
+  if (!isConnected()) {
+    result.islanded = true;
+  } else {
+    sol_V = mBaseV;
+    sol_D = mBaseD;
+    result.converged = solvePowerflow();
+    result.iterations = mIterations;
+    if (result.converged)
+      checkLimits(outage, result);
+  }
+
+  // Restore the exact previous values instead of adding the stamp again
+  for (UInt a = 0; a < 2; ++a)
+    for (UInt b = 0; b < 2; ++b)
+      mY.coeffRef(nodes[a], nodes[b]) = previous[a][b];
+
+  std::chrono::duration<double> duration =
+      std::chrono::steady_clock::now() - start;
+  result.solveTime = duration.count();
+}
+
+std::vector<PFContingencyAnalysis::Result> PFContingencyAnalysis::run() {
+  generateInitialSolution(0);
+  if (!solvePowerflow())
+    throw std::runtime_error("Base case of contingency analysis did not "
+                             "converge");
+  setSolution();
+  mBaseV = sol_V;
+  mBaseD = sol_D;
+  collectBranches();
+
+  UInt numThreads = mNumThreads > 0 ? mNumThreads
+                                    : std::thread::hardware_concurrency();
+  numThreads = std::max<UInt>(
+      1, std::min<UInt>(numThreads, static_cast<UInt>(mBranches.size())));
+
+  // Every further worker needs its own admittance matrix, Jacobian and
+  // solution vectors. The workers are set up sequentially because the
+  // initialization touches the shared components.
+  std::vector<std::unique_ptr<PFContingencyAnalysis>> workers;
+  std::vector<PFContingencyAnalysis *> solvers{this};
+  for (UInt t = 1; t < numThreads; ++t) {
+    auto worker = std::make_unique<PFContingencyAnalysis>(
+        mName + "_worker" + std::to_string(t), mSystem, mTimeStep,
+        Logger::Level::off);
+    worker->mBehaviour = mBehaviour;
+    worker->mInitFromNodesAndTerminals = mInitFromNodesAndTerminals;
+    worker->initialize();
+    worker->generateInitialSolution(0);
+    worker->copyBaseCase(*this);
+    solvers.push_back(worker.get());
+    workers.push_back(std::move(worker));
+  }
+
+  std::vector<Result> results(mBranches.size());
+  std::atomic<UInt> next(0);
+  std::exception_ptr error;
+  std::mutex errorMutex;
+
+  auto work = [&](PFContingencyAnalysis *solver) {
+    try {
+      for (UInt c = next++; c < results.size(); c = next++)
+        solver->evaluate(c, results[c]);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(errorMutex);
+      if (!error)
+        error = std::current_exception();
+      next = static_cast<UInt>(results.size());
+    }
+  };
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (UInt t = 1; t < numThreads; ++t)
+    threads.emplace_back(work, solvers[t]);
+  work(this);
+  for (auto &thread : threads)
+    thread.join();
+  if (error)
+    std::rethrow_exception(error);
+  std::chrono::duration<double> duration =
+      std::chrono::steady_clock::now() - start;
+
+  // Leave the base case solution in the solver
+  sol_V = mBaseV;
+  sol_D = mBaseD;
+
+  UInt numConverged = 0, numIslanded = 0, numViolations = 0;
+  for (auto &result : results) {
+    if (result.islanded)
+      ++numIslanded;
+    if (result.converged)
+      ++numConverged;
+    if (!result.violations.empty())
+      ++numViolations;
+  }
+  SPDLOG_LOGGER_INFO(mSLog,
+                     "{} outages on {} threads in {:.6f} s: {} converged, "
+                     "{} islanded, {} with limit violations",
+                     results.size(), numThreads, duration.count(),
+                     numConverged, numIslanded, numViolations);
+
+  return results;
+}
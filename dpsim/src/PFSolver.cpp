@@ -60,7 +60,9 @@ void PFSolver::initialize() {
   determineNodeBaseVoltages();
   composeAdmittanceMatrix();
 
-  mJ.setZero(mNumUnknowns, mNumUnknowns);
+  mJ.resize(mNumUnknowns, mNumUnknowns);
+  mJacobianAnalyzed = false;
+  initializeJacobianPattern();
   mX.setZero(mNumUnknowns);
   mF.setZero(mNumUnknowns);
 }
@@ -410,8 +412,7 @@ void PFSolver::composeAdmittanceMatrix() {
       line->pfApplyAdmittanceMatrixStamp(mY);
     }
     for (auto trans : mTransformers) {
-      //to check if this transformer could be ignored
-      if (**trans->mResistance == 0 && **trans->mInductance == 0) {
+      if (!isAdmittanceStamped(*trans)) {
         SPDLOG_LOGGER_INFO(mSLog, "{} {} ignored for R = 0 and L = 0",
                            trans->type(), trans->name());
         continue;
@@ -421,6 +422,7 @@ void PFSolver::composeAdmittanceMatrix() {
     for (auto shunt : mShunts) {
       shunt->pfApplyAdmittanceMatrixStamp(mY);
     }
+    mY.makeCompressed();
   }
   if (mLines.empty() && mTransformers.empty()) {
     throw std::invalid_argument("There are no bus");
@@ -451,12 +453,22 @@ Bool PFSolver::solvePowerflow() {
   for (unsigned i = 1; i < mMaxIterations && !isConverged; ++i) {
 
     calculateJacobian();
-    auto sparseJ = mJ.sparseView();
 
-    // Solve system mJ*mX = mF
-    Eigen::SparseLU<SparseMatrix> lu(sparseJ);
+    // The pattern of mJ does not change, so the symbolic analysis is reused
+    // and only the numeric factorization is repeated
+    if (!mJacobianAnalyzed) {
+      mJLU.analyzePattern(mJ);
+      mJacobianAnalyzed = true;
+    }
+    mJLU.factorize(mJ);
+    if (mJLU.info() != Eigen::Success) {
+      SPDLOG_LOGGER_ERROR(mSLog, "Factorization of Jacobian failed: {}",
+                          mJLU.lastErrorMessage());
+      break;
+    }
 
-    mX = lu.solve(mF); /* code */
+    // Solve system mJ*mX = mF
+    mX = mJLU.solve(mF);
 
     // Calculate new solution based on mX increments obtained from equation system
     updateSolution();
@@ -0,0 +1,129 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <dpsim/PFSolverFastDecoupled.h>
+
+using namespace DPsim;
+using namespace CPS;
+
+PFSolverFastDecoupled::PFSolverFastDecoupled(CPS::String name,
+                                             const CPS::SystemTopology &system,
+                                             CPS::Real timeStep,
+                                             CPS::Logger::Level logLevel)
+    : PFSolverPowerPolar(name, system, timeStep, logLevel) {
+  // Convergence is linear, so more but much cheaper iterations are needed
+  mMaxIterations = 50;
+}
+
+void PFSolverFastDecoupled::initializeJacobianPattern() {
+  UInt npqpv = mNumPQBuses + mNumPVBuses;
+
+  // Position of each bus in mPQPVBusIndices, -1 for VD buses
+  std::vector<Int> position(mSystem.mNodes.size(), -1);
+  for (UInt a = 0; a < npqpv; ++a)
+    position[mPQPVBusIndices[a]] = a;
+
+  std::vector<Eigen::Triplet<Real>> bPrime;
+  std::vector<Eigen::Triplet<Real>> bDoublePrime;
+
+  for (UInt a = 0; a < npqpv; ++a) {
+    UInt k = mPQPVBusIndices[a];
+    bool pq = a < mNumPQBuses;
+    Real bPrimeDiag = 0;
+
+    for (SparseMatrixCompRow::InnerIterator it(mY, k); it; ++it) {
+      UInt j = it.col();
+      if (j == k) {
+        if (pq)
+          bDoublePrime.emplace_back(a, a, -it.value().imag());
+        continue;
+      }
+
+      // Series reactance of the branch between k and j, neglecting its
+      // resistance. Entries to VD buses still contribute to the diagonal.
+      Complex y = it.value();
+      if (y == Complex(0., 0.))
+        continue;
+      Real x = (-1. / y).imag();
+      Real b = x != 0 ? 1. / x : 0.;
+      bPrimeDiag += b;
+
+      Int col = position[j];
+      if (col < 0)
+        continue;
+      bPrime.emplace_back(a, col, -b);
+      if (pq && static_cast<UInt>(col) < mNumPQBuses)
+        bDoublePrime.emplace_back(a, col, -y.imag());
+    }
+    bPrime.emplace_back(a, a, bPrimeDiag);
+  }
+
+  mBPrime.resize(npqpv, npqpv);
+  mBPrime.setFromTriplets(bPrime.begin(), bPrime.end());
+  mBDoublePrime.resize(mNumPQBuses, mNumPQBuses);
+  mBDoublePrime.setFromTriplets(bDoublePrime.begin(), bDoublePrime.end());
+
+  mBPrimeLU.compute(mBPrime);
+  if (mBPrimeLU.info() != Eigen::Success)
+    throw std::runtime_error("Factorization of B' failed: " +
+                             mBPrimeLU.lastErrorMessage());
+  if (mNumPQBuses > 0) {
+    mBDoublePrimeLU.compute(mBDoublePrime);
+    if (mBDoublePrimeLU.info() != Eigen::Success)
+      throw std::runtime_error("Factorization of B'' failed: " +
+                               mBDoublePrimeLU.lastErrorMessage());
+  }
+
+  mDeltaP.setZero(npqpv);
+  mDeltaTheta.setZero(npqpv);
+  mDeltaQ.setZero(mNumPQBuses);
+  mDeltaV.setZero(mNumPQBuses);
+
+  SPDLOG_LOGGER_INFO(mSLog, "B' with {} and B'' with {} nonzeros",
+                     mBPrime.nonZeros(), mBDoublePrime.nonZeros());
+}
+
+Bool PFSolverFastDecoupled::solvePowerflow() {
+  UInt npqpv = mNumPQBuses + mNumPVBuses;
+
+  // Calculate the mismatch according to the initial solution
+  calculateMismatch();
+
+  // Check whether model already converged
+  isConverged = checkConvergence();
+
+  mIterations = 0;
+  for (unsigned i = 1; i < mMaxIterations && !isConverged; ++i) {
+    // P-theta half step: B' * dTheta = dP / V
+    for (UInt a = 0; a < npqpv; ++a)
+      mDeltaP(a) = mF(a) / sol_V.coeff(mPQPVBusIndices[a]);
+    mDeltaTheta = mBPrimeLU.solve(mDeltaP);
+    for (UInt a = 0; a < npqpv; ++a)
+      sol_D(mPQPVBusIndices[a]) += mDeltaTheta(a);
+
+    calculateMismatch();
+
+    // Q-V half step: B'' * dV = dQ / V
+    if (mNumPQBuses > 0) {
+      for (UInt a = 0; a < mNumPQBuses; ++a)
+        mDeltaQ(a) = mF(npqpv + a) / sol_V.coeff(mPQPVBusIndices[a]);
+      mDeltaV = mBDoublePrimeLU.solve(mDeltaQ);
+      for (UInt a = 0; a < mNumPQBuses; ++a)
+        sol_V(mPQPVBusIndices[a]) += mDeltaV(a);
+
+      calculateMismatch();
+    }
+
+    SPDLOG_LOGGER_DEBUG(mSLog, "Mismatch vector at iteration {}: \n {}", i, mF);
+
+    // Check convergence
+    isConverged = checkConvergence();
+    mIterations = i;
+  }
+  return isConverged;
+}
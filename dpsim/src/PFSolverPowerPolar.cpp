@@ -206,105 +206,125 @@ void PFSolverPowerPolar::calculateMismatch() {
   }
 }
 
-void PFSolverPowerPolar::calculateJacobian() {
+void PFSolverPowerPolar::initializeJacobianPattern() {
   UInt npqpv = mNumPQBuses + mNumPVBuses;
-  double val;
-  UInt k, j;
-  UInt da, db;
 
-  mJ.setZero();
+  // Position of each bus in mPQPVBusIndices, -1 for VD buses
+  std::vector<Int> position(mSystem.mNodes.size(), -1);
+  for (UInt a = 0; a < npqpv; ++a)
+    position[mPQPVBusIndices[a]] = a;
+
+  // The sub-matrices J1 to J4 are located at these offsets in mJ
+  auto entryAt = [npqpv](UInt a, UInt b, bool j2, bool j3, bool j4,
+                         std::vector<Eigen::Triplet<Real>> &triplets) {
+    triplets.emplace_back(a, b, 0.);
+    if (j2)
+      triplets.emplace_back(a, b + npqpv, 0.);
+    if (j3)
+      triplets.emplace_back(a + npqpv, b, 0.);
+    if (j4)
+      triplets.emplace_back(a + npqpv, b + npqpv, 0.);
+  };
+
+  std::vector<Eigen::Triplet<Real>> triplets;
+  std::vector<std::pair<UInt, UInt>> offDiagonal;
+  mJacobianDiagonal.clear();
+  mJacobianOffDiagonal.clear();
 
-  //J1
-  for (UInt a = 0; a < npqpv; ++a) { //rows
-    k = mPQPVBusIndices[a];
-    //diagonal
-    mJ.coeffRef(a, a) = -Q(k) - B(k, k) * sol_V.coeff(k) * sol_V.coeff(k);
-
-    //non diagonal elements
-    for (UInt b = 0; b < npqpv; ++b) {
-      if (b != a) {
-        j = mPQPVBusIndices[b];
-        val = sol_V.coeff(k) * sol_V.coeff(j) *
-              (G(k, j) * sin(sol_D.coeff(k) - sol_D.coeff(j)) -
-               B(k, j) * cos(sol_D.coeff(k) - sol_D.coeff(j)));
-        //if (val != 0.0)
-        mJ.coeffRef(a, b) = val;
+  for (UInt a = 0; a < npqpv; ++a) {
+    UInt k = mPQPVBusIndices[a];
+    bool pq = a < mNumPQBuses;
+    JacobianEntry diag{k, k, -1, -1, -1, -1, -1};
+
+    for (Int p = mY.outerIndexPtr()[k]; p < mY.outerIndexPtr()[k + 1]; ++p) {
+      UInt j = mY.innerIndexPtr()[p];
+      if (j == k) {
+        diag.y = p;
+        continue;
       }
+      Int b = position[j];
+      if (b < 0)
+        continue;
+      bool pqj = static_cast<UInt>(b) < mNumPQBuses;
+      entryAt(a, b, pqj, pq, pq && pqj, triplets);
+      mJacobianOffDiagonal.push_back({k, j, p, -1, -1, -1, -1});
+      offDiagonal.emplace_back(a, b);
     }
+    entryAt(a, a, pq, pq, pq, triplets);
+    mJacobianDiagonal.push_back(diag);
   }
 
-  //J2
-  da = 0;
-  db = npqpv;
-  for (UInt a = 0; a < npqpv; ++a) { //rows
-    k = mPQPVBusIndices[a];
-    //diagonal
-    //std::cout << "J2D:" << (a + da) << "," << (a + db) << std::endl;
+  mJ.resize(mNumUnknowns, mNumUnknowns);
+  mJ.setFromTriplets(triplets.begin(), triplets.end());
+  mJ.makeCompressed();
+
+  // Position of the value at (row, col) in mJ, -1 if it is not in the pattern
+  auto valueIndex = [this](UInt row, UInt col) -> Int {
+    const int *begin = mJ.innerIndexPtr() + mJ.outerIndexPtr()[col];
+    const int *end = mJ.innerIndexPtr() + mJ.outerIndexPtr()[col + 1];
+    const int *it = std::lower_bound(begin, end, static_cast<int>(row));
+    if (it == end || *it != static_cast<int>(row))
+      return -1;
+    return static_cast<Int>(it - mJ.innerIndexPtr());
+  };
+  auto setPositions = [&](JacobianEntry &entry, UInt a, UInt b) {
+    entry.j1 = valueIndex(a, b);
+    if (b < mNumPQBuses)
+      entry.j2 = valueIndex(a, b + npqpv);
     if (a < mNumPQBuses)
-      mJ.coeffRef(a + da, a + db) =
-          P(k) + G(k, k) * sol_V.coeff(k) * sol_V.coeff(k);
-
-    //non diagonal elements
-    for (UInt b = 0; b < mNumPQBuses; ++b) {
-      if (b != a) {
-        j = mPQPVBusIndices[b];
-        val = sol_V.coeff(k) * sol_V.coeff(j) *
-              (G(k, j) * cos(sol_D.coeff(k) - sol_D.coeff(j)) +
-               B(k, j) * sin(sol_D.coeff(k) - sol_D.coeff(j)));
-        //if (val != 0.0)
-        //std::cout << "J2ij:" << (a + da) << "," << (b + db) << std::endl;
-        mJ.coeffRef(a + da, b + db) = val;
-      }
-    }
-  }
+      entry.j3 = valueIndex(a + npqpv, b);
+    if (a < mNumPQBuses && b < mNumPQBuses)
+      entry.j4 = valueIndex(a + npqpv, b + npqpv);
+  };
+
+  for (UInt a = 0; a < npqpv; ++a)
+    setPositions(mJacobianDiagonal[a], a, a);
+  for (size_t i = 0; i < offDiagonal.size(); ++i)
+    setPositions(mJacobianOffDiagonal[i], offDiagonal[i].first,
+                 offDiagonal[i].second);
+
+  SPDLOG_LOGGER_INFO(mSLog, "Jacobian with {} nonzeros for {} unknowns",
+                     mJ.nonZeros(), mNumUnknowns);
+}
 
-  //J3
-  da = npqpv;
-  db = 0;
-  for (UInt a = 0; a < mNumPQBuses; ++a) { //rows
-    k = mPQPVBusIndices[a];
-    //diagonal
-    //std::cout << "J3:" << (a + da) << "," << (a + db) << std::endl;
-    mJ.coeffRef(a + da, a + db) =
-        P(k) - G(k, k) * sol_V.coeff(k) * sol_V.coeff(k);
-
-    //non diagonal elements
-    for (UInt b = 0; b < npqpv; ++b) {
-      if (b != a) {
-        j = mPQPVBusIndices[b];
-        val = sol_V.coeff(k) * sol_V.coeff(j) *
-              (G(k, j) * cos(sol_D.coeff(k) - sol_D.coeff(j)) +
-               B(k, j) * sin(sol_D.coeff(k) - sol_D.coeff(j)));
-        //if (val != 0.0)
-        //std::cout << "J3:" << (a + da) << "," << (b + db) << std::endl;
-        mJ.coeffRef(a + da, b + db) = -val;
-      }
-    }
+void PFSolverPowerPolar::calculateJacobian() {
+  Real *values = mJ.valuePtr();
+  const Complex *y = mY.valuePtr();
+
+  for (auto &entry : mJacobianDiagonal) {
+    UInt k = entry.k;
+    Complex ykk = entry.y >= 0 ? y[entry.y] : Complex(0., 0.);
+    Real v2 = sol_V.coeff(k) * sol_V.coeff(k);
+    Real p = P(k);
+    Real q = Q(k);
+
+    values[entry.j1] = -q - ykk.imag() * v2;
+    if (entry.j2 >= 0)
+      values[entry.j2] = p + ykk.real() * v2;
+    if (entry.j3 >= 0)
+      values[entry.j3] = p - ykk.real() * v2;
+    if (entry.j4 >= 0)
+      values[entry.j4] = q - ykk.imag() * v2;
   }
 
-  //J4
-  da = npqpv;
-  db = npqpv;
-  for (UInt a = 0; a < mNumPQBuses; ++a) { //rows
-    k = mPQPVBusIndices[a];
-    //diagonal
-    //std::cout << "J4:" << (a + da) << "," << (a + db) << std::endl;
-    mJ.coeffRef(a + da, a + db) =
-        Q(k) - B(k, k) * sol_V.coeff(k) * sol_V.coeff(k);
-
-    //non diagonal elements
-    for (UInt b = 0; b < mNumPQBuses; ++b) {
-      if (b != a) {
-        j = mPQPVBusIndices[b];
-        val = sol_V.coeff(k) * sol_V.coeff(j) *
-              (G(k, j) * sin(sol_D.coeff(k) - sol_D.coeff(j)) -
-               B(k, j) * cos(sol_D.coeff(k) - sol_D.coeff(j)));
-        if (val != 0.0) {
-          //std::cout << "J4:" << (a + da) << "," << (b + db) << std::endl;
-          mJ.coeffRef(a + da, b + db) = val;
-        }
-      }
-    }
+  for (auto &entry : mJacobianOffDiagonal) {
+    UInt k = entry.k;
+    UInt j = entry.j;
+    Real g = y[entry.y].real();
+    Real b = y[entry.y].imag();
+    Real vv = sol_V.coeff(k) * sol_V.coeff(j);
+    Real sinD = sin(sol_D.coeff(k) - sol_D.coeff(j));
+    Real cosD = cos(sol_D.coeff(k) - sol_D.coeff(j));
+    Real dPdD = vv * (g * sinD - b * cosD);
+    Real dPdV = vv * (g * cosD + b * sinD);
+
+    values[entry.j1] = dPdD;
+    if (entry.j2 >= 0)
+      values[entry.j2] = dPdV;
+    if (entry.j3 >= 0)
+      values[entry.j3] = -dPdV;
+    if (entry.j4 >= 0)
+      values[entry.j4] = dPdD;
   }
 }
 
@@ -412,31 +432,40 @@ void PFSolverPowerPolar::calculateNodalInjection() {
 
 Real PFSolverPowerPolar::P(UInt k) {
   Real val = 0.0;
-  for (UInt j = 0; j < mSystem.mNodes.size(); ++j) {
-    val += sol_V.coeff(j) * (G(k, j) * cos(sol_D.coeff(k) - sol_D.coeff(j)) +
-                             B(k, j) * sin(sol_D.coeff(k) - sol_D.coeff(j)));
+  for (SparseMatrixCompRow::InnerIterator it(mY, k); it; ++it) {
+    UInt j = it.col();
+    val += sol_V.coeff(j) *
+           (it.value().real() * cos(sol_D.coeff(k) - sol_D.coeff(j)) +
+            it.value().imag() * sin(sol_D.coeff(k) - sol_D.coeff(j)));
   }
   return sol_V.coeff(k) * val;
 }
 
 Real PFSolverPowerPolar::Q(UInt k) {
   Real val = 0.0;
-  for (UInt j = 0; j < mSystem.mNodes.size(); ++j) {
-    val += sol_V.coeff(j) * (G(k, j) * sin(sol_D.coeff(k) - sol_D.coeff(j)) -
-                             B(k, j) * cos(sol_D.coeff(k) - sol_D.coeff(j)));
+  for (SparseMatrixCompRow::InnerIterator it(mY, k); it; ++it) {
+    UInt j = it.col();
+    val += sol_V.coeff(j) *
+           (it.value().real() * sin(sol_D.coeff(k) - sol_D.coeff(j)) -
+            it.value().imag() * cos(sol_D.coeff(k) - sol_D.coeff(j)));
   }
   return sol_V.coeff(k) * val;
 }
 
+Complex PFSolverPowerPolar::injectedCurrent(UInt k) {
+  Complex current(0.0, 0.0);
+  for (SparseMatrixCompRow::InnerIterator it(mY, k); it; ++it)
+    current += it.value() * sol_Vcx(it.col());
+  return current;
+}
+
 void PFSolverPowerPolar::calculatePAndQAtSlackBus() {
   // calculates apparent power injection at slack buses flowing to other nodes (i.e. S_inj_to_other = S_inj - S_shunt, with S_inj = S_gen - S_load)
   for (auto topoNode : mVDBuses) {
     auto node_idx = topoNode->matrixNodeIndex();
 
     // calculate power flowing out of the node into the admittance matrix (i.e. S_inj)
-    CPS::Complex I(0.0, 0.0);
-    for (UInt j = 0; j < mSystem.mNodes.size(); ++j)
-      I += mY.coeff(node_idx, j) * sol_Vcx(j);
+    CPS::Complex I = injectedCurrent(node_idx);
     CPS::Complex S = sol_Vcx(node_idx) * conj(I);
 
     // add load power to obtain generator power (S_gen = S_inj + S_load)
@@ -481,9 +510,7 @@ void PFSolverPowerPolar::calculateQAtPVBuses() {
     auto node_idx = topoNode->matrixNodeIndex();
 
     // calculate power flowing out of the node into the admittance matrix (i.e. S_inj)
-    CPS::Complex I(0.0, 0.0);
-    for (UInt j = 0; j < mSystem.mNodes.size(); ++j)
-      I += mY.coeff(node_idx, j) * sol_Vcx(j);
+    CPS::Complex I = injectedCurrent(node_idx);
     Complex S = sol_Vcx(node_idx) * conj(I);
 
     // add load power to obtain generator power (S_gen = S_inj + S_load)
@@ -518,9 +545,7 @@ void PFSolverPowerPolar::calculatePAndQInjectionPQBuses() {
     auto node_idx = topoNode->matrixNodeIndex();
 
     // calculate power flowing out of the node into the admittance matrix (i.e. S_inj)
-    CPS::Complex I(0.0, 0.0);
-    for (UInt j = 0; j < mSystem.mNodes.size(); ++j)
-      I += mY.coeff(node_idx, j) * sol_Vcx(j);
+    CPS::Complex I = injectedCurrent(node_idx);
     CPS::Complex S = sol_Vcx(node_idx) * conj(I);
 
     // Subtracting shunt power to obtain power injection flowing from this node to the other nodes (i.e. S_inj_to_other)
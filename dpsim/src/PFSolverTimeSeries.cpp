@@ -0,0 +1,189 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <fstream>
+
+#include <dpsim/PFSolverTimeSeries.h>
+
+using namespace DPsim;
+using namespace CPS;
+
+PFSolverTimeSeries::PFSolverTimeSeries(CPS::String name,
+                                       const CPS::SystemTopology &system,
+                                       CPS::Real timeStep,
+                                       CPS::Logger::Level logLevel)
+    : PFSolverPowerPolar(name, system, timeStep, logLevel) {
+  // Iterations with an outdated Jacobian converge slower
+  mMaxIterations = 20;
+}
+
+void PFSolverTimeSeries::updateProfileLoads(Real time) {
+  for (UInt i = 0; i < mProfileLoads.size(); ++i) {
+    auto &load = mProfileLoads[i];
+    load->updatePQ(time);
+    **load->mActivePowerPerUnit = **load->mActivePower / mBaseApparentPower;
+    **load->mReactivePowerPerUnit =
+        **load->mReactivePower / mBaseApparentPower;
+    mProfileP(i) = **load->mActivePowerPerUnit;
+    mProfileQ(i) = **load->mReactivePowerPerUnit;
+  }
+}
+
+void PFSolverTimeSeries::generateInitialSolution(Real time,
+                                                 bool keep_last_solution) {
+  if (!mInjectionsInitialized) {
+    PFSolverPowerPolar::generateInitialSolution(time, false);
+
+    // Separate the profile loads from the constant injections
+    mProfileLoads.clear();
+    mProfileLoadNodes.clear();
+    for (auto load : mLoads) {
+      if (!load->use_profile)
+        continue;
+      mProfileLoads.push_back(load);
+      mProfileLoadNodes.push_back(load->node(0)->matrixNodeIndex());
+    }
+    mProfileP.setZero(mProfileLoads.size());
+    mProfileQ.setZero(mProfileLoads.size());
+
+    mPespBase = Pesp;
+    mQespBase = Qesp;
+    for (UInt i = 0; i < mProfileLoads.size(); ++i) {
+      mPespBase(mProfileLoadNodes[i]) +=
+          **mProfileLoads[i]->mActivePowerPerUnit;
+      mQespBase(mProfileLoadNodes[i]) +=
+          **mProfileLoads[i]->mReactivePowerPerUnit;
+    }
+
+    SPDLOG_LOGGER_INFO(mSLog, "{} of {} loads follow a profile",
+                       mProfileLoads.size(), mLoads.size());
+    mInjectionsInitialized = true;
+    return;
+  }
+
+  // The previous solution is the starting point, only the profile loads
+  // change the specified injections
+  updateProfileLoads(time);
+  Pesp = mPespBase;
+  Qesp = mQespBase;
+  for (UInt i = 0; i < mProfileLoads.size(); ++i) {
+    Pesp(mProfileLoadNodes[i]) -= mProfileP(i);
+    Qesp(mProfileLoadNodes[i]) -= mProfileQ(i);
+  }
+}
+
+Bool PFSolverTimeSeries::solvePowerflow() {
+  calculateMismatch();
+  isConverged = checkConvergence();
+  Real mismatch = mF.lpNorm<Eigen::Infinity>();
+
+  mIterations = 0;
+  for (unsigned i = 1; i < mMaxIterations && !isConverged; ++i) {
+    if (!mFactorizationValid) {
+      calculateJacobian();
+      if (!mJacobianAnalyzed) {
+        mJLU.analyzePattern(mJ);
+        mJacobianAnalyzed = true;
+      }
+      mJLU.factorize(mJ);
+      if (mJLU.info() != Eigen::Success) {
+        SPDLOG_LOGGER_ERROR(mSLog, "Factorization of Jacobian failed: {}",
+                            mJLU.lastErrorMessage());
+        break;
+      }
+      mFactorizationValid = true;
+      ++mNumFactorizations;
+    }
+
+    mX = mJLU.solve(mF);
+    updateSolution();
+    calculateMismatch();
+
+    // Recompute the Jacobian once the outdated one stops contracting the
+    // mismatch quickly enough
+    Real newMismatch = mF.lpNorm<Eigen::Infinity>();
+    if (newMismatch > mReuseContraction * mismatch)
+      mFactorizationValid = false;
+    mismatch = newMismatch;
+
+    isConverged = checkConvergence();
+    mIterations = i;
+  }
+
+  if (!isConverged)
+    mFactorizationValid = false;
+  return isConverged;
+}
+
+void PFSolverTimeSeries::solveTimeSeries(Real startTime, UInt numSteps) {
+  UInt numNodes = mSystem.mNodes.size();
+  mResultTimes.resize(numSteps);
+  mResultVoltageMagnitudes.resize(numSteps, numNodes);
+  mResultVoltageAngles.resize(numSteps, numNodes);
+  mResultIterations.assign(numSteps, -1);
+
+  UInt numConverged = 0;
+  UInt totalIterations = 0;
+  UInt factorizationsBefore = mNumFactorizations;
+
+  for (UInt step = 0; step < numSteps; ++step) {
+    Real time = startTime + step * mTimeStep;
+    generateInitialSolution(time);
+    solvePowerflow();
+
+    mResultTimes(step) = time;
+    mResultVoltageMagnitudes.row(step) = sol_V.transpose();
+    mResultVoltageAngles.row(step) = sol_D.transpose();
+    if (isConverged) {
+      mResultIterations[step] = mIterations;
+      ++numConverged;
+    } else {
+      SPDLOG_LOGGER_WARN(mSLog, "Not converged at t={} within {} iterations",
+                         time, mIterations);
+    }
+    totalIterations += mIterations;
+  }
+
+  // Store the last solution in the nodes and components
+  if (numSteps > 0)
+    setSolution();
+
+  SPDLOG_LOGGER_INFO(mSLog,
+                     "Time series with {} points: {} converged, {} "
+                     "iterations, {} factorizations",
+                     numSteps, numConverged, totalIterations,
+                     mNumFactorizations - factorizationsBefore);
+}
+
+void PFSolverTimeSeries::writeResults(const String &filename) const {
+  std::ofstream file(filename);
+  if (!file.is_open())
+    throw std::runtime_error("Cannot open " + filename);
+
+  fmt::memory_buffer buffer;
+  fmt::format_to(std::back_inserter(buffer), "time");
+  for (auto node : mSystem.mNodes)
+    fmt::format_to(std::back_inserter(buffer), ",{0}.V_pu,{0}.angle",
+                   node->name());
+  buffer.push_back('\n');
+
+  for (Eigen::Index step = 0; step < mResultTimes.size(); ++step) {
+    fmt::format_to(std::back_inserter(buffer), "{:.6f}", mResultTimes(step));
+    for (Eigen::Index col = 0; col < mResultVoltageMagnitudes.cols(); ++col)
+      fmt::format_to(std::back_inserter(buffer), ",{:.9f},{:.9f}",
+                     mResultVoltageMagnitudes(step, col),
+                     mResultVoltageAngles(step, col));
+    buffer.push_back('\n');
+
+    if (buffer.size() > (1 << 20)) {
+      file.write(buffer.data(), buffer.size());
+      buffer.clear();
+    }
+  }
+  file.write(buffer.data(), buffer.size());
+}
@@ -5,7 +5,9 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <chrono>
 #include <iomanip>
+#include <iterator>
 #include <memory>
 
 #include <dpsim/RealTimeDataLogger.h>
@@ -17,18 +19,45 @@ using namespace DPsim;
 
 RealTimeDataLogger::RealTimeDataLogger(std::filesystem::path &filename,
                                        size_t rowNumber)
-    : DataLoggerInterface(), mFilename(filename), mRowNumber(rowNumber),
-      mCurrentRow(0), mCurrentAttribute(0), mAttributeData() {}
+    : RealTimeDataLogger(filename, rowNumber, Mode::Preallocate) {}
 
 RealTimeDataLogger::RealTimeDataLogger(std::filesystem::path &filename,
                                        Real finalTime, Real timeStep)
-    : DataLoggerInterface(), mFilename(filename),
-      mRowNumber((finalTime / timeStep + 0.5)), mCurrentRow(0),
-      mCurrentAttribute(0), mAttributeData() {}
+    : RealTimeDataLogger(filename,
+                         static_cast<size_t>(finalTime / timeStep + 0.5),
+                         Mode::Preallocate) {}
+
+RealTimeDataLogger::RealTimeDataLogger(std::filesystem::path &filename,
+                                       size_t rowNumber, Mode mode,
+                                       Real drainInterval)
+    : DataLoggerInterface(), mFilename(filename), mMode(mode),
+      mRowNumber(rowNumber), mCurrentRow(0), mCurrentAttribute(0),
+      mColumns(), mRowSize(0), mAttributeData(), mLogFile(), mDrainThread(),
+      mDraining(false), mHead(0), mTail(0), mDroppedRows(0),
+      mDrainInterval(drainInterval) {
+  if (mMode == Mode::Stream && mRowNumber == 0) {
+    throw std::runtime_error(
+        "RealTimeDataLogger: The ring buffer needs at least one row");
+  }
+}
+
+RealTimeDataLogger::~RealTimeDataLogger() {
+  if (mDrainThread.joinable()) {
+    mDraining = false;
+    mDrainThread.join();
+  }
+}
 
 void RealTimeDataLogger::start() {
-  double mb_size =
-      static_cast<double>(mRowNumber) * (mAttributes.size() + 1) * sizeof(Real);
+  if (mDrainThread.joinable()) {
+    throw std::runtime_error(
+        "RealTimeDataLogger: Logger has already been started");
+  }
+  mColumns = resolveColumns("RealTimeDataLogger");
+  // We have to add one to the size because we also log the time
+  mRowSize = mColumns.size() + 1;
+
+  double mb_size = static_cast<double>(mRowNumber) * mRowSize * sizeof(Real);
   auto log = CPS::Logger::get("RealTimeDataLogger", CPS::Logger::Level::off,
                               CPS::Logger::Level::info);
   SPDLOG_LOGGER_INFO(
@@ -37,20 +66,48 @@ void RealTimeDataLogger::start() {
       "attributes ({} MB)",
       mRowNumber, mAttributes.size(), mb_size / (1024 * 1024));
   // We are doing real time so preallocate everything
-  mAttributeData.resize(mRowNumber);
-  for (auto &it : mAttributeData) {
-    // We have to add one to the size because we also log the time
-    it.resize(mAttributes.size() + 1);
+  mAttributeData.assign(mRowNumber * mRowSize, 0.0);
+
+  if (mMode == Mode::Stream) {
+    openLogFile();
+    writeHeader();
+    mHead = 0;
+    mTail = 0;
+    mDroppedRows = 0;
+    mDraining = true;
+    mDrainThread = std::thread(&RealTimeDataLogger::drain, this);
   }
 }
 
 void RealTimeDataLogger::stop() {
   auto log = CPS::Logger::get("RealTimeDataLogger", CPS::Logger::Level::off,
                               CPS::Logger::Level::info);
-  SPDLOG_LOGGER_INFO(
-      log, "Stopping real-time data logger. Writing memory to file {}",
-      mFilename.string());
 
+  if (mMode == Mode::Stream) {
+    SPDLOG_LOGGER_INFO(log, "Stopping real-time data logger. Draining to {}",
+                       mFilename.string());
+    mDraining = false;
+    if (mDrainThread.joinable())
+      mDrainThread.join();
+    mLogFile.close();
+    if (mDroppedRows > 0)
+      SPDLOG_LOGGER_WARN(log, "Dropped {} rows because the drain fell behind",
+                         mDroppedRows.load());
+  } else {
+    SPDLOG_LOGGER_INFO(
+        log, "Stopping real-time data logger. Writing memory to file {}",
+        mFilename.string());
+    openLogFile();
+    writeHeader();
+    String buffer;
+    writeRows(0, mRowNumber, buffer);
+    mLogFile.close();
+  }
+  SPDLOG_LOGGER_INFO(log, "Finished writing real-time data log to file {}",
+                     mFilename.string());
+}
+
+void RealTimeDataLogger::openLogFile() {
   const auto parent = mFilename.parent_path();
   if (!parent.empty()) {
     std::error_code ec;
@@ -61,60 +118,105 @@ void RealTimeDataLogger::stop() {
     }
   }
 
-  auto mLogFile =
-      std::ofstream(mFilename, std::ios_base::out | std::ios_base::trunc);
+  mLogFile = std::ofstream(mFilename, std::ios_base::out |
+                                          std::ios_base::trunc |
+                                          std::ios_base::binary);
   if (!mLogFile.is_open()) {
     throw std::runtime_error("Cannot open log file " + mFilename.string());
   }
+}
+
+std::vector<String> RealTimeDataLogger::columnNames() const {
+  std::vector<String> names{"time"};
+  for (auto &it : mAttributes)
+    names.push_back(it.first);
+  return names;
+}
 
+void RealTimeDataLogger::writeHeader() {
   mLogFile << std::right << std::setw(14) << "time";
-  for (auto it : mAttributes)
+  for (auto &it : mAttributes)
     mLogFile << ", " << std::right << std::setw(13) << it.first;
   mLogFile << '\n';
+}
 
-  for (auto row : mAttributeData) {
-    mLogFile << std::scientific << std::right << std::setw(14) << row[0];
-    for (size_t i = 1; i < row.size(); ++i)
-      mLogFile << ", " << std::right << std::setw(13) << row[i];
-    mLogFile << '\n';
+void RealTimeDataLogger::writeRows(size_t begin, size_t end, String &buffer) {
+  buffer.clear();
+  for (size_t row = begin; row < end; ++row) {
+    const Real *values = &mAttributeData[(row % mRowNumber) * mRowSize];
+    fmt::format_to(std::back_inserter(buffer), "{:>14e}", values[0]);
+    for (size_t i = 1; i < mRowSize; ++i)
+      fmt::format_to(std::back_inserter(buffer), ", {:>13e}", values[i]);
+    buffer.push_back('\n');
+
+    if (buffer.size() >= WRITE_CHUNK_SIZE) {
+      mLogFile.write(buffer.data(), buffer.size());
+      buffer.clear();
+    }
   }
-  mLogFile.close();
-  SPDLOG_LOGGER_INFO(log, "Finished writing real-time data log to file {}",
-                     mFilename.string());
+  mLogFile.write(buffer.data(), buffer.size());
+  buffer.clear();
+}
+
+void RealTimeDataLogger::fillRow(Real *row, Real time) {
+  row[0] = time;
+  mCurrentAttribute = 1;
+
+  for (auto &col : mColumns)
+    row[mCurrentAttribute++] = col.value();
 }
 
 void RealTimeDataLogger::log(Real time, Int timeStepCount) {
+  if (mAttributeData.size() != mRowNumber * mRowSize || mRowSize == 0) {
+    throw std::runtime_error(
+        "RealTimeDataLogger: Attribute data size mismatch");
+  }
+
+  if (mMode == Mode::Stream) {
+    // Never block the simulation: if the drain thread has not caught up,
+    // the row is counted as dropped instead.
+    size_t head = mHead.load(std::memory_order_relaxed);
+    if (head - mTail.load(std::memory_order_acquire) >= mRowNumber) {
+      mDroppedRows.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    mCurrentRow = head % mRowNumber;
+    fillRow(&mAttributeData[mCurrentRow * mRowSize], time);
+    mHead.store(head + 1, std::memory_order_release);
+    return;
+  }
+
   mCurrentRow = timeStepCount;
   if (timeStepCount < 0 || static_cast<size_t>(timeStepCount) >= mRowNumber) {
     throw std::runtime_error(
         "RealTimeDataLogger: timeStepCount out of bounds. Please verify the "
         "logger was initialized correctly.");
   }
-  if (mAttributeData.size() != mRowNumber ||
-      mAttributeData[mCurrentRow].size() != mAttributes.size() + 1) {
-    throw std::runtime_error(
-        "RealTimeDataLogger: Attribute data size mismatch");
-  }
-  mAttributeData[mCurrentRow][0] = time;
-  mCurrentAttribute = 1;
+  fillRow(&mAttributeData[mCurrentRow * mRowSize], time);
+}
 
-  for (auto &it : mAttributes) {
-    auto base = it.second.getPtr(); // std::shared_ptr<CPS::AttributeBase>
-
-    if (it.second->getType() == typeid(Real)) {
-      auto attr = std::dynamic_pointer_cast<CPS::Attribute<Real>>(base);
-      if (!attr) { /* skip */
-        continue;
-      }
-      mAttributeData[mCurrentRow][mCurrentAttribute++] = attr->get();
-    } else if (it.second->getType() == typeid(Int)) {
-      auto attr = std::dynamic_pointer_cast<CPS::Attribute<Int>>(base);
-      if (!attr) { /* skip */
-        continue;
-      }
-      mAttributeData[mCurrentRow][mCurrentAttribute++] = attr->get();
+void RealTimeDataLogger::drain() {
+  String buffer;
+  buffer.reserve(WRITE_CHUNK_SIZE);
+  auto interval = std::chrono::duration<Real>(mDrainInterval);
+
+  while (true) {
+    // Read the flag before the head so that rows logged before stop() are
+    // always written out in the final pass.
+    bool draining = mDraining.load(std::memory_order_acquire);
+    size_t head = mHead.load(std::memory_order_acquire);
+    size_t tail = mTail.load(std::memory_order_relaxed);
+
+    if (head != tail) {
+      writeRows(tail, head, buffer);
+      mTail.store(head, std::memory_order_release);
+    } else if (!draining) {
+      break;
+    } else {
+      std::this_thread::sleep_for(interval);
     }
   }
+  mLogFile.flush();
 }
 
 void RealTimeDataLogger::Step::execute(Real time, Int timeStepCount) {
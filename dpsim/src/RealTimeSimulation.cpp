@@ -7,14 +7,84 @@
  *********************************************************************************/
 
 #include <chrono>
+#include <cstring>
 #include <ctime>
 #include <dpsim/RealTimeSimulation.h>
+#include <dpsim/SequentialScheduler.h>
 #include <iomanip>
 #include <spdlog/fmt/chrono.h>
 
+#ifdef WITH_RT
+#include <malloc.h>
+#include <sys/mman.h>
+#endif
+
 using namespace CPS;
 using namespace DPsim;
 
+namespace {
+/// Last task of the warm-up schedule. Depends on everything the solver tasks
+/// modify, so that the scheduler does not drop tasks whose results are only
+/// used by interfaces and loggers.
+class WarmupSink : public Task {
+public:
+  explicit WarmupSink(const Task::List &tasks) : Task("Preflight.Sink") {
+    for (auto &task : tasks) {
+      for (auto &attr : task->getModifiedAttributes()) {
+        if (attr.getPtr() != Scheduler::external.getPtr())
+          mAttributeDependencies.push_back(attr);
+      }
+    }
+    mModifiedAttributes.push_back(Scheduler::external);
+  }
+
+  void execute(Real time, Int timeStepCount) override {}
+};
+
+using Snapshot = std::vector<std::pair<AttributeBase::Ptr, AttributeBase::Ptr>>;
+
+/// Copy the static attributes of `obj`, which hold its state
+void saveAttributes(const IdentifiedObject &obj, Snapshot &snapshot) {
+  for (auto &[_name, attr] : obj.attributes()) {
+    if (attr->isStatic())
+      snapshot.emplace_back(attr, attr->cloneValueOntoNewAttribute());
+  }
+}
+
+void saveComponent(const IdentifiedObject::Ptr &comp, Snapshot &snapshot);
+
+/// Save the virtual nodes and subcomponents, which are not part of the
+/// system topology
+template <typename VarType>
+bool saveSubObjects(const IdentifiedObject::Ptr &obj, Snapshot &snapshot) {
+  auto comp = std::dynamic_pointer_cast<SimPowerComp<VarType>>(obj);
+  if (!comp)
+    return false;
+  for (auto &node : comp->virtualNodes())
+    saveAttributes(*node, snapshot);
+  for (auto &subComp : comp->subComponents())
+    saveComponent(subComp, snapshot);
+  return true;
+}
+
+void saveComponent(const IdentifiedObject::Ptr &comp, Snapshot &snapshot) {
+  saveAttributes(*comp, snapshot);
+  if (!saveSubObjects<Real>(comp, snapshot))
+    saveSubObjects<Complex>(comp, snapshot);
+}
+
+/// Touch `size` bytes of the stack below the caller
+void __attribute__((noinline)) prefaultStack(size_t size) {
+  constexpr size_t chunk = 16 * 1024;
+  char buffer[chunk];
+  std::memset(buffer, 0, chunk);
+  if (size > chunk)
+    prefaultStack(size - chunk);
+  // Keep the compiler from removing the stores or reusing the frame
+  asm volatile("" : : "r"(buffer) : "memory");
+}
+} // namespace
+
 RealTimeSimulation::RealTimeSimulation(String name, CommandLineArgs &args)
     : Simulation(name, args), mTimer(){};
 
@@ -29,10 +99,100 @@ void RealTimeSimulation::run(const Timer::StartClock::duration &startIn) {
   run(Timer::StartClock::now() + startIn);
 }
 
+void RealTimeSimulation::preflight() {
+  SPDLOG_LOGGER_INFO(mLog, "Running real-time preflight.");
+
+#ifdef WITH_RT
+  if (mPreflight.lockMemory) {
+    // Keep freed memory in the process, so that later allocations do not
+    // fault in new pages
+    mallopt(M_TRIM_THRESHOLD, -1);
+    mallopt(M_MMAP_MAX, 0);
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) < 0)
+      SPDLOG_LOGGER_WARN(mLog, "Failed to lock memory: {}",
+                         std::strerror(errno));
+  }
+#else
+  if (mPreflight.lockMemory)
+    SPDLOG_LOGGER_WARN(mLog, "Memory locking is not supported");
+#endif
+  prefaultStack(mPreflight.stackSize);
+
+  if (mPreflight.warmupSteps == 0)
+    return;
+
+  mWorstCaseStepTime = warmup(mPreflight.warmupSteps);
+  Real load = mWorstCaseStepTime / **mTimeStep;
+  SPDLOG_LOGGER_INFO(mLog,
+                     "Worst-case step time in {} warm-up steps: {:.1f} us "
+                     "({:.0f}% of the time step)",
+                     mPreflight.warmupSteps, mWorstCaseStepTime * 1e6,
+                     load * 100);
+
+  if (load > mPreflight.maxLoad) {
+    if (mPreflight.failOnInsufficientMargin) {
+      SPDLOG_LOGGER_ERROR(mLog,
+                          "Worst-case step time exceeds {:.0f}% of the time "
+                          "step, refusing to start",
+                          mPreflight.maxLoad * 100);
+      throw PreflightException{mWorstCaseStepTime};
+    }
+    SPDLOG_LOGGER_WARN(mLog,
+                       "Worst-case step time exceeds {:.0f}% of the time "
+                       "step, expect overruns",
+                       mPreflight.maxLoad * 100);
+  }
+}
+
+Real RealTimeSimulation::warmup(UInt steps) {
+  Snapshot snapshot;
+  for (auto &comp : mSystem.mComponents)
+    saveComponent(comp, snapshot);
+  for (auto &node : mSystem.mNodes)
+    saveAttributes(*node, snapshot);
+
+  // The scheduled tasks of the solvers on a sequential schedule without the
+  // interface and logger tasks, so that nothing is sent or logged
+  for (auto &solver : mSolvers) {
+    solver->setLogSuspended(true);
+    solver->setLogSolveTimes(false);
+  }
+  Task::List tasks = mSolverTasks;
+  tasks.push_back(std::make_shared<WarmupSink>(tasks));
+
+  SequentialScheduler scheduler;
+  Scheduler::Edges inEdges, outEdges;
+  scheduler.resolveDeps(tasks, inEdges, outEdges);
+  scheduler.createSchedule(tasks, inEdges, outEdges);
+
+  std::chrono::steady_clock::duration worstCase{0};
+  Real time = 0;
+  for (UInt step = 0; step < steps; step++) {
+    auto start = std::chrono::steady_clock::now();
+    scheduler.step(time, static_cast<Int>(step));
+    worstCase = std::max(worstCase, std::chrono::steady_clock::now() - start);
+    time += **mTimeStep;
+  }
+
+  // Values derived within a step, e.g. history terms and the solution
+  // vector, are computed again from the restored state in the next step
+  for (auto &[attr, value] : snapshot)
+    attr->copyValue(value);
+  for (auto &solver : mSolvers) {
+    solver->setLogSuspended(false);
+    solver->setLogSolveTimes(mLogStepTimes);
+  }
+
+  return std::chrono::duration<Real>(worstCase).count();
+}
+
 void RealTimeSimulation::run(const Timer::StartClock::time_point &startAt) {
   if (!mInitialized)
     initialize();
 
+  if (mPreflightEnabled)
+    preflight();
+
   for (auto lg : mLoggers)
     lg->start();
 
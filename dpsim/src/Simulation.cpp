@@ -8,6 +8,7 @@
 #include <dpsim-models/Utils.h>
 #include <dpsim/DiakopticsSolver.h>
 #include <dpsim/MNASolverFactory.h>
+#include <dpsim/PFSolverFastDecoupled.h>
 #include <dpsim/PFSolverPowerPolar.h>
 #include <dpsim/SequentialScheduler.h>
 #include <dpsim/Simulation.h>
@@ -21,6 +22,7 @@
 
 #ifdef WITH_SUNDIALS
 #include <dpsim-models/Solver/ODEInterface.h>
+#include <dpsim/CoupledODESolver.h>
 #include <dpsim/DAESolver.h>
 #include <dpsim/ODESolver.h>
 #endif
@@ -64,6 +66,17 @@ void Simulation::initialize() {
   if (mInitialized)
     return;
 
+  createSolversForDomain();
+
+  mTime = 0;
+  mTimeStepCount = 0;
+
+  schedule();
+
+  mInitialized = true;
+}
+
+void Simulation::createSolversForDomain() {
   mSolvers.clear();
 
   switch (mDomain) {
@@ -76,13 +89,6 @@ void Simulation::initialize() {
     createSolvers<Real>();
     break;
   }
-
-  mTime = 0;
-  mTimeStepCount = 0;
-
-  schedule();
-
-  mInitialized = true;
 }
 
 template <typename VarType> void Simulation::createSolvers() {
@@ -105,6 +111,14 @@ template <typename VarType> void Simulation::createSolvers() {
     solver->initialize();
     mSolvers.push_back(solver);
     break;
+  case Solver::Type::FDLF:
+    solver = std::make_shared<PFSolverFastDecoupled>(**mName, mSystem,
+                                                     **mTimeStep, mLogLevel);
+    solver->doInitFromNodesAndTerminals(mInitFromNodesAndTerminals);
+    solver->setSolverAndComponentBehaviour(mSolverBehaviour);
+    solver->initialize();
+    mSolvers.push_back(solver);
+    break;
   default:
     throw UnsupportedSolverException();
   }
@@ -112,9 +126,19 @@ template <typename VarType> void Simulation::createSolvers() {
   // Some components require a dedicated ODE solver.
   // This solver is independent of the system solver.
 #ifdef WITH_SUNDIALS
+  std::vector<ODEInterface::Ptr> odeComps;
   for (auto comp : mSystem.mComponents) {
     auto odeComp = std::dynamic_pointer_cast<ODEInterface>(comp);
-    if (odeComp) {
+    if (odeComp)
+      odeComps.push_back(odeComp);
+  }
+
+  if (mCoupledODESolver && !odeComps.empty()) {
+    mSolvers.push_back(std::make_shared<CoupledODESolver>(
+        **mName + "_ODE", odeComps, mImplicitODEIntegration, **mTimeStep,
+        mLogLevel));
+  } else {
+    for (auto odeComp : odeComps) {
       // TODO explicit / implicit integration
       auto odeSolver = std::make_shared<ODESolver>(
           odeComp->mAttributeList->attributeTyped<String>("name")->get() +
@@ -146,7 +170,8 @@ template <typename VarType> void Simulation::createMNASolver() {
     if (mTearComponents.size() > 0) {
       // Tear components available, use diakoptics
       solver = std::make_shared<DiakopticsSolver<VarType>>(
-          **mName, subnets[net], mTearComponents, **mTimeStep, mLogLevel);
+          **mName, subnets[net], mTearComponents, **mTimeStep, mLogLevel,
+          mDirectImpl, mDirectLinearSolverConfiguration);
     } else {
       // Default case with lu decomposition from mna factory
       solver = MnaSolverFactory::factory<VarType>(**mName + copySuffix, mDomain,
@@ -192,6 +217,7 @@ void Simulation::prepSchedule() {
       mTasks.push_back(t);
     }
   }
+  mSolverTasks = mTasks;
 
   for (auto intf : mInterfaces) {
     for (auto t : intf->getTasks()) {
@@ -320,7 +346,8 @@ void Simulation::start() {
 
   // In PF we dont log the initial conditions of the componentes because they are not calculated
   // In dynamic simulations log initial values of attributes (t=0)
-  if (mSolverType != Solver::Type::NRP) {
+  if (mSolverType != Solver::Type::NRP &&
+      mSolverType != Solver::Type::FDLF) {
     if (mLoggers.size() > 0)
       mLoggers[0]->log(0, 0);
 
@@ -360,6 +387,21 @@ Real Simulation::next() {
   return mTime;
 }
 
+Real Simulation::runSteps(UInt steps) {
+  for (UInt i = 0; i < steps && mTime < **mFinalTime + DOUBLE_EPSILON; i++)
+    step();
+
+  return mTime;
+}
+
+Real Simulation::runUntil(Real time) {
+  while (mTime < time - DOUBLE_EPSILON &&
+         mTime < **mFinalTime + DOUBLE_EPSILON)
+    step();
+
+  return mTime;
+}
+
 void Simulation::run() {
   start();
 
@@ -6,6 +6,7 @@
  * file, You can obtain one at https://mozilla.org/MPL/2.0/.
  *********************************************************************************/
 
+#include <algorithm>
 #include <assert.h>
 #include <thread>
 
@@ -24,6 +25,8 @@ Timer::Timer(int flags, CPS::Logger::Level logLevel)
     : mState(stopped), mOverruns(0), mTicks(0), mFlags(flags),
       mLogLevel(logLevel) {
   mSLog = CPS::Logger::get("Timer");
+  if (mFlags & Flags::fail_on_overrun)
+    mOverrunPolicy = OverrunPolicy::Fail;
 #ifdef HAVE_TIMERFD
   mTimerFd = timerfd_create(CLOCK_MONOTONIC, 0);
   if (mTimerFd < 0) {
@@ -51,8 +54,8 @@ Timer::~Timer() {
 #endif
 }
 
-void Timer::sleep() {
-  uint64_t ticks = 0, overruns;
+uint64_t Timer::waitSleep() {
+  uint64_t ticks = 0;
 
 #ifdef HAVE_TIMERFD
   ssize_t bytes;
@@ -65,23 +68,76 @@ void Timer::sleep() {
 #else
   std::this_thread::sleep_until(mNextTick);
 
-  auto now = IntervalClock::now();
+  ticks = 1 + (IntervalClock::now() - mNextTick) / mTickInterval;
+#endif
+  return ticks;
+}
 
-  while (mNextTick < now) {
-    mNextTick += mTickInterval;
-    ticks++;
+uint64_t Timer::waitHybrid() {
+  IntervalTimePoint wakeAt = mNextTick - mGuard;
+  if (IntervalClock::now() < wakeAt) {
+#ifdef HAVE_TIMERFD
+    uint64_t expirations;
+    struct itimerspec ts = {.it_interval = {0, 0},
+                            .it_value = to_timespec(wakeAt.time_since_epoch())};
+
+    if (timerfd_settime(mTimerFd, TFD_TIMER_ABSTIME, &ts, 0) < 0)
+      throw SystemError("Failed to arm timerfd");
+    if (read(mTimerFd, &expirations, sizeof(expirations)) < 0) {
+      SPDLOG_LOGGER_ERROR(mSLog, "Read from timerfd failed");
+      throw SystemError("Read from timerfd failed");
+    }
+#else
+    std::this_thread::sleep_until(wakeAt);
+#endif
   }
 
+  IntervalTimePoint now;
+  while ((now = IntervalClock::now()) < mNextTick) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
 #endif
-  overruns = ticks - 1;
+  }
+
+  return 1 + (now - mNextTick) / mTickInterval;
+}
 
+void Timer::sleep() {
+  IntervalTimePoint entry = IntervalClock::now();
+  if (mTicks > 0)
+    mComputeTime.record((entry - mLastWakeup).count());
+
+  if (mPendingTicks > 0) {
+    // Catching up, the tick has passed already
+    mPendingTicks--;
+    mTicks++;
+    mLastWakeup = entry;
+    return;
+  }
+
+  uint64_t ticks = mMode == Mode::Hybrid ? waitHybrid() : waitSleep();
+  mLastWakeup = IntervalClock::now();
+
+  // Deadline of the last of the passed ticks
+  IntervalTimePoint deadline = mNextTick + (ticks - 1) * mTickInterval;
+  mLateness.record(
+      std::max<Ticks::rep>((mLastWakeup - deadline).count(), 0));
+  mNextTick = deadline + mTickInterval;
+
+  uint64_t overruns = ticks - 1;
   mOverruns += overruns;
-  mTicks += ticks;
+
+  if (mOverrunPolicy == OverrunPolicy::CatchUp) {
+    mPendingTicks = overruns;
+    mTicks++;
+  } else {
+    mTicks += ticks;
+  }
 
   if (overruns > 0) {
     SPDLOG_LOGGER_WARN(mSLog, "Timer overrun of {} timesteps at {}", overruns,
                        mTicks);
-    if (mFlags & Flags::fail_on_overrun) {
+    if (mOverrunPolicy == OverrunPolicy::Fail) {
       SPDLOG_LOGGER_ERROR(mSLog, "The overrun has made the simulation to fail "
                                  "because the flag is active");
       throw OverrunException{overruns};
@@ -94,6 +150,9 @@ void Timer::start() {
 
   mTicks = 0;
   mOverruns = 0;
+  mPendingTicks = 0;
+  mLateness.reset();
+  mComputeTime.reset();
 
   // Determine offset between clocks.
   auto rt = StartClock::now();
@@ -109,16 +168,19 @@ void Timer::start() {
                    : steady.time_since_epoch();
 
 #ifdef HAVE_TIMERFD
-  int ret;
-  struct itimerspec ts = {.it_interval = to_timespec(mTickInterval),
-                          .it_value = to_timespec(start)};
-
-  ret = timerfd_settime(mTimerFd, TFD_TIMER_ABSTIME, &ts, 0);
-  if (ret < 0) {
-    throw SystemError("Failed to arm timerfd");
+  // In hybrid mode, the timer is armed for each tick by sleep()
+  if (mMode == Mode::Sleep) {
+    int ret;
+    struct itimerspec ts = {.it_interval = to_timespec(mTickInterval),
+                            .it_value = to_timespec(start)};
+
+    ret = timerfd_settime(mTimerFd, TFD_TIMER_ABSTIME, &ts, 0);
+    if (ret < 0) {
+      throw SystemError("Failed to arm timerfd");
+    }
   }
 #endif
-  mNextTick = IntervalTimePoint(start) + mTickInterval;
+  mNextTick = IntervalTimePoint(start);
   mState = State::running;
 }
 
@@ -136,4 +198,9 @@ void Timer::stop() {
 #endif
 
   mState = State::stopped;
+
+  if (mLateness.count() > 0)
+    SPDLOG_LOGGER_INFO(mSLog, "Wake-up lateness: {}", mLateness.summary());
+  if (mComputeTime.count() > 0)
+    SPDLOG_LOGGER_INFO(mSLog, "Step compute time: {}", mComputeTime.summary());
 }
@@ -0,0 +1,178 @@
+/* Copyright 2017-2024 Institute for Automation of Complex Power Systems,
+ *                     EONERC, RWTH Aachen University
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ *********************************************************************************/
+
+#include <cmath>
+#include <iomanip>
+#include <iterator>
+#include <limits>
+
+#include <dpsim-models/Logger.h>
+#include <dpsim/TriggeredDataLogger.h>
+
+using namespace DPsim;
+
+TriggeredDataLogger::TriggeredDataLogger(String name, UInt preTriggerSteps,
+                                         UInt postTriggerSteps,
+                                         UInt coarseDownsampling, Bool enabled)
+    : DataLoggerInterface(), mName(name), mEnabled(enabled),
+      mPreTriggerSteps(preTriggerSteps), mPostTriggerSteps(postTriggerSteps),
+      mCoarseDownsampling(coarseDownsampling), mRowSize(0),
+      mRingRows(preTriggerSteps + 1), mRingHead(0), mRingFill(0),
+      mTriggerPending(false), mPostRemaining(0), mLastWrittenStep(-1),
+      mTriggerCount(0) {
+  if (!mEnabled)
+    return;
+
+  mFilename = CPS::Logger::logDir() + "/" + name + ".csv";
+
+  if (mFilename.has_parent_path() && !fs::exists(mFilename.parent_path()))
+    fs::create_directory(mFilename.parent_path());
+}
+
+void TriggeredDataLogger::addThresholdTrigger(CPS::Attribute<Real>::Ptr attr,
+                                              Real threshold, Edge edge) {
+  mThresholdTriggers.push_back(
+      {attr, threshold, edge, std::numeric_limits<Real>::quiet_NaN()});
+}
+
+void TriggeredDataLogger::addChangeTrigger(CPS::Attribute<Bool>::Ptr attr) {
+  mChangeTriggers.push_back({attr, false, false});
+}
+
+Event::Ptr TriggeredDataLogger::triggerOn(Event::Ptr event) {
+  return TriggerEvent::make(event->time(), event, shared_from_this());
+}
+
+void TriggeredDataLogger::start() {
+  if (!mEnabled)
+    return;
+
+  mColumns = resolveColumns("TriggeredDataLogger");
+  // We have to add one to the size because we also log the time
+  mRowSize = mColumns.size() + 1;
+  // Preallocate the ring so that logging does not allocate
+  mRing.assign(mRingRows * mRowSize, 0.0);
+  mRingSteps.assign(mRingRows, -1);
+  mRingHead = 0;
+  mRingFill = 0;
+  mPostRemaining = 0;
+  mLastWrittenStep = -1;
+  mBuffer.reserve(WRITE_CHUNK_SIZE);
+
+  mLogFile =
+      std::ofstream(mFilename, std::ios_base::out | std::ios_base::trunc);
+  if (!mLogFile.is_open())
+    throw std::runtime_error("TriggeredDataLogger: Cannot open log file " +
+                             mFilename.string());
+
+  mLogFile << std::right << std::setw(14) << "time";
+  for (auto &it : mAttributes)
+    mLogFile << ", " << std::right << std::setw(13) << it.first;
+  mLogFile << '\n';
+}
+
+void TriggeredDataLogger::stop() {
+  if (!mEnabled)
+    return;
+
+  flushBuffer();
+  mLogFile.close();
+}
+
+void TriggeredDataLogger::fillRow(Real *row, Real time) {
+  row[0] = time;
+  size_t idx = 1;
+  for (auto &col : mColumns)
+    row[idx++] = col.value();
+}
+
+bool TriggeredDataLogger::checkTriggers() {
+  // Evaluate all triggers so that their previous values stay up to date
+  bool triggered = mTriggerPending;
+  mTriggerPending = false;
+
+  for (auto &trigger : mThresholdTriggers) {
+    Real value = **trigger.attr;
+    Real prev = trigger.previous;
+    trigger.previous = value;
+    if (std::isnan(prev))
+      continue;
+
+    bool rising = prev < trigger.threshold && value >= trigger.threshold;
+    bool falling = prev > trigger.threshold && value <= trigger.threshold;
+    if ((rising && trigger.edge != Edge::Falling) ||
+        (falling && trigger.edge != Edge::Rising))
+      triggered = true;
+  }
+
+  for (auto &trigger : mChangeTriggers) {
+    Bool value = **trigger.attr;
+    if (trigger.primed && value != trigger.previous)
+      triggered = true;
+    trigger.previous = value;
+    trigger.primed = true;
+  }
+
+  return triggered;
+}
+
+void TriggeredDataLogger::appendRow(const Real *row, Int timeStepCount) {
+  fmt::format_to(std::back_inserter(mBuffer), "{:>14e}", row[0]);
+  for (size_t i = 1; i < mRowSize; ++i)
+    fmt::format_to(std::back_inserter(mBuffer), ", {:>13e}", row[i]);
+  mBuffer.push_back('\n');
+  mLastWrittenStep = timeStepCount;
+
+  if (mBuffer.size() >= WRITE_CHUNK_SIZE)
+    flushBuffer();
+}
+
+void TriggeredDataLogger::flushBuffer() {
+  mLogFile.write(mBuffer.data(), mBuffer.size());
+  mBuffer.clear();
+}
+
+void TriggeredDataLogger::log(Real time, Int timeStepCount) {
+  if (!mEnabled)
+    return;
+
+  size_t slot = mRingHead;
+  Real *row = &mRing[slot * mRowSize];
+  fillRow(row, time);
+  mRingSteps[slot] = timeStepCount;
+  mRingHead = (mRingHead + 1) % mRingRows;
+  if (mRingFill < mRingRows)
+    ++mRingFill;
+
+  if (checkTriggers()) {
+    ++mTriggerCount;
+    // Write the pre-trigger window including the current step, skipping
+    // rows which are already in the file
+    size_t oldest = (mRingHead + mRingRows - mRingFill) % mRingRows;
+    for (size_t k = 0; k < mRingFill; ++k) {
+      size_t idx = (oldest + k) % mRingRows;
+      if (mRingSteps[idx] > mLastWrittenStep)
+        appendRow(&mRing[idx * mRowSize], mRingSteps[idx]);
+    }
+    mPostRemaining = mPostTriggerSteps;
+  } else if (mPostRemaining > 0) {
+    appendRow(row, timeStepCount);
+    --mPostRemaining;
+  } else if (mCoarseDownsampling > 0 &&
+             timeStepCount % mCoarseDownsampling == 0) {
+    appendRow(row, timeStepCount);
+  }
+}
+
+void TriggeredDataLogger::Step::execute(Real time, Int timeStepCount) {
+  mLogger.log(time, timeStepCount);
+}
+
+CPS::Task::Ptr TriggeredDataLogger::getTask() {
+  return std::make_shared<TriggeredDataLogger::Step>(*this);
+}
@@ -47,7 +47,7 @@ CommandLineArgs::CommandLineArgs(int argc, char *argv[], String nm, Real dt,
           {"start-in", required_argument, 0, 'i', "SECS", ""},
           {"solver-domain", required_argument, 0, 'D', "(SP|DP|EMT)",
            "Domain of solver"},
-          {"solver-type", required_argument, 0, 'T', "(NRP|MNA)",
+          {"solver-type", required_argument, 0, 'T', "(NRP|FDLF|MNA)",
            "Type of solver"},
           {"linear-solver-impl", required_argument, 0, 'U',
            "(DenseLU|SparseLU|KLU|CUDADense|CUDASparse)",
@@ -88,7 +88,7 @@ CommandLineArgs::CommandLineArgs(String nm, Real dt, Real d, Real sf, Int s,
           {"start-in", required_argument, 0, 'i', "SECS", ""},
           {"solver-domain", required_argument, 0, 'D', "(SP|DP|EMT)",
            "Domain of solver"},
-          {"solver-type", required_argument, 0, 'T', "(NRP|MNA)",
+          {"solver-type", required_argument, 0, 'T', "(NRP|FDLF|MNA)",
            "Type of solver"},
           {"linear-solver-impl", required_argument, 0, 'U',
            "(DenseLU|SparseLU|KLU|CUDADense|CUDASparse)",
@@ -202,9 +202,12 @@ void CommandLineArgs::parseArguments(int argc, char *argv[]) {
         solver.type = Solver::Type::MNA;
       else if (arg == "NRP")
         solver.type = Solver::Type::NRP;
+      else if (arg == "FDLF")
+        solver.type = Solver::Type::FDLF;
       else
         throw std::invalid_argument(
-            "Invalid value for --solver-type: must be a string of NRP or MNA");
+            "Invalid value for --solver-type: must be a string of NRP, "
+            "FDLF or MNA");
       break;
     }
     case 'U': {
@@ -6,6 +6,8 @@
  * file, You can obtain one at https://mozilla.org/MPL/2.0/.
  *********************************************************************************/
 
+#include <pybind11/complex.h>
+
 #include <DPsim.h>
 #include <dpsim-models/CSVReader.h>
 #include <dpsim-models/IdentifiedObject.h>
@@ -19,6 +21,21 @@ PYBIND11_DECLARE_HOLDER_TYPE(T, CPS::AttributePointer<T>);
 namespace py = pybind11;
 using namespace pybind11::literals;
 
+// Describes the column-major storage of a matrix attribute, so that NumPy
+// arrays created from the attribute alias its value instead of copying it.
+// The storage only stays valid as long as the matrix is not resized. For
+// dynamic attributes, the buffer is the value at the time it is requested.
+template <typename T>
+static py::buffer_info matrixAttributeBuffer(CPS::Attribute<T> &attr) {
+  using Scalar = typename T::Scalar;
+  T &matrix = attr.get();
+  py::ssize_t itemSize = sizeof(Scalar);
+  return py::buffer_info(matrix.data(), itemSize,
+                         py::format_descriptor<Scalar>::format(), 2,
+                         {matrix.rows(), matrix.cols()},
+                         {itemSize, itemSize * matrix.rows()});
+}
+
 void addAttributes(py::module_ m) {
 
   py::class_<CPS::AttributeBase, CPS::AttributePointer<CPS::AttributeBase>>(
@@ -77,7 +94,8 @@ void addAttributes(py::module_ m) {
 
   py::class_<CPS::Attribute<CPS::Matrix>,
              CPS::AttributePointer<CPS::Attribute<CPS::Matrix>>,
-             CPS::AttributeBase>(m, "AttributeMatrix")
+             CPS::AttributeBase>(m, "AttributeMatrix", py::buffer_protocol())
+      .def_buffer(&matrixAttributeBuffer<CPS::Matrix>)
       .def("get", &CPS::Attribute<CPS::Matrix>::get)
       .def("set", &CPS::Attribute<CPS::Matrix>::set)
       .def("derive_coeff",
@@ -85,15 +103,19 @@ void addAttributes(py::module_ m) {
 
   py::class_<CPS::AttributeStatic<CPS::Matrix>,
              CPS::AttributePointer<CPS::AttributeStatic<CPS::Matrix>>,
-             CPS::Attribute<CPS::Matrix>>(m, "AttributeMatrixStat");
+             CPS::Attribute<CPS::Matrix>>(m, "AttributeMatrixStat",
+                                          py::buffer_protocol());
   py::class_<CPS::AttributeDynamic<CPS::Matrix>,
              CPS::AttributePointer<CPS::AttributeDynamic<CPS::Matrix>>,
-             CPS::Attribute<CPS::Matrix>>(m, "AttributeMatrixDyn")
+             CPS::Attribute<CPS::Matrix>>(m, "AttributeMatrixDyn",
+                                          py::buffer_protocol())
       .def("set_reference", &CPS::AttributeDynamic<CPS::Matrix>::setReference);
 
   py::class_<CPS::Attribute<CPS::MatrixComp>,
              CPS::AttributePointer<CPS::Attribute<CPS::MatrixComp>>,
-             CPS::AttributeBase>(m, "AttributeMatrixComp")
+             CPS::AttributeBase>(m, "AttributeMatrixComp",
+                                 py::buffer_protocol())
+      .def_buffer(&matrixAttributeBuffer<CPS::MatrixComp>)
       .def("get", &CPS::Attribute<CPS::MatrixComp>::get)
       .def("set", &CPS::Attribute<CPS::MatrixComp>::set)
       .def("derive_coeff",
@@ -101,10 +123,12 @@ void addAttributes(py::module_ m) {
 
   py::class_<CPS::AttributeStatic<CPS::MatrixComp>,
              CPS::AttributePointer<CPS::AttributeStatic<CPS::MatrixComp>>,
-             CPS::Attribute<CPS::MatrixComp>>(m, "AttributeMatrixCompStat");
+             CPS::Attribute<CPS::MatrixComp>>(m, "AttributeMatrixCompStat",
+                                              py::buffer_protocol());
   py::class_<CPS::AttributeDynamic<CPS::MatrixComp>,
              CPS::AttributePointer<CPS::AttributeDynamic<CPS::MatrixComp>>,
-             CPS::Attribute<CPS::MatrixComp>>(m, "AttributeMatrixCompDyn")
+             CPS::Attribute<CPS::MatrixComp>>(m, "AttributeMatrixCompDyn",
+                                              py::buffer_protocol())
       .def("set_reference",
            &CPS::AttributeDynamic<CPS::MatrixComp>::setReference);
 
@@ -35,6 +35,21 @@ PYBIND11_DECLARE_HOLDER_TYPE(T, CPS::AttributePointer<T>);
 namespace py = pybind11;
 using namespace pybind11::literals;
 
+// Read-only NumPy view of a logged column. The capsule shares the ownership
+// of the values, so that they outlive a restart of the logger without
+// being copied.
+static py::array_t<DPsim::Real>
+columnView(std::shared_ptr<const std::vector<DPsim::Real>> data) {
+  using Column = std::shared_ptr<const std::vector<DPsim::Real>>;
+  py::capsule base(new Column(data), [](void *column) {
+    delete static_cast<Column *>(column);
+  });
+  py::array_t<DPsim::Real> array(static_cast<py::ssize_t>(data->size()),
+                                 data->data(), base);
+  array.attr("flags").attr("writeable") = false;
+  return array;
+}
+
 PYBIND11_MODULE(dpsimpy, m) {
   m.doc() = R"pbdoc(
   DPsim Python bindings
@@ -100,7 +115,8 @@ PYBIND11_MODULE(dpsimpy, m) {
   py::enum_<DPsim::Solver::Type>(m, "Solver")
       .value("MNA", DPsim::Solver::Type::MNA)
       .value("DAE", DPsim::Solver::Type::DAE)
-      .value("NRP", DPsim::Solver::Type::NRP);
+      .value("NRP", DPsim::Solver::Type::NRP)
+      .value("FDLF", DPsim::Solver::Type::FDLF);
 
   py::enum_<DPsim::DirectLinearSolverImpl>(m, "DirectLinearSolverImpl")
       .value("Undef", DPsim::DirectLinearSolverImpl::Undef)
@@ -180,12 +196,21 @@ PYBIND11_MODULE(dpsimpy, m) {
       .def("set_final_time", &DPsim::Simulation::setFinalTime)
       .def("add_logger", &DPsim::Simulation::addLogger)
       .def("set_system", &DPsim::Simulation::setSystem)
-      .def("run", &DPsim::Simulation::run)
+      .def("run", &DPsim::Simulation::run,
+           py::call_guard<py::gil_scoped_release>())
       .def("set_solver", &DPsim::Simulation::setSolverType)
       .def("set_domain", &DPsim::Simulation::setDomain)
-      .def("start", &DPsim::Simulation::start)
-      .def("next", &DPsim::Simulation::next)
-      .def("stop", &DPsim::Simulation::stop)
+      .def("start", &DPsim::Simulation::start,
+           py::call_guard<py::gil_scoped_release>())
+      .def("next", &DPsim::Simulation::next,
+           py::call_guard<py::gil_scoped_release>())
+      .def("step_n", &DPsim::Simulation::runSteps, "steps"_a,
+           py::call_guard<py::gil_scoped_release>())
+      .def("run_until", &DPsim::Simulation::runUntil, "time"_a,
+           py::call_guard<py::gil_scoped_release>())
+      .def("stop", &DPsim::Simulation::stop,
+           py::call_guard<py::gil_scoped_release>())
+      .def("time", &DPsim::Simulation::time)
       .def("get_idobj_attr", &DPsim::Simulation::getIdObjAttribute, "comp"_a,
            "attr"_a)
       .def("add_interface", &DPsim::Simulation::addInterface, "interface"_a)
@@ -201,6 +226,8 @@ PYBIND11_MODULE(dpsimpy, m) {
       .def("do_frequency_parallelization",
            &DPsim::Simulation::doFrequencyParallelization)
       .def("do_split_subnets", &DPsim::Simulation::doSplitSubnets)
+      .def("do_coupled_ode_solver", &DPsim::Simulation::doCoupledODESolver,
+           "value"_a = true, "implicit"_a = false)
       .def("set_tearing_components", &DPsim::Simulation::setTearingComponents)
       .def("add_event", &DPsim::Simulation::addEvent)
       .def("set_solver_component_behaviour",
@@ -222,7 +249,8 @@ PYBIND11_MODULE(dpsimpy, m) {
       .def("set_system", &DPsim::RealTimeSimulation::setSystem)
       .def("run",
            static_cast<void (DPsim::RealTimeSimulation::*)(CPS::Int startIn)>(
-               &DPsim::RealTimeSimulation::run))
+               &DPsim::RealTimeSimulation::run),
+           py::call_guard<py::gil_scoped_release>())
       .def("set_solver", &DPsim::RealTimeSimulation::setSolverType)
       .def("set_domain", &DPsim::RealTimeSimulation::setDomain);
 
@@ -324,8 +352,14 @@ PYBIND11_MODULE(dpsimpy, m) {
            });
 
   py::class_<DPsim::RealTimeDataLogger, DPsim::DataLoggerInterface,
-             std::shared_ptr<DPsim::RealTimeDataLogger>>(m,
-                                                         "RealTimeDataLogger")
+             std::shared_ptr<DPsim::RealTimeDataLogger>>
+      realTimeDataLogger(m, "RealTimeDataLogger");
+
+  py::enum_<DPsim::RealTimeDataLogger::Mode>(realTimeDataLogger, "Mode")
+      .value("Preallocate", DPsim::RealTimeDataLogger::Mode::Preallocate)
+      .value("Stream", DPsim::RealTimeDataLogger::Mode::Stream);
+
+  realTimeDataLogger
 
       .def(py::init([](py::object filename, DPsim::Real final_time,
                        DPsim::Real time_step) {
@@ -347,6 +381,43 @@ PYBIND11_MODULE(dpsimpy, m) {
            }),
            "filename"_a, "row_number"_a)
 
+      .def(py::init([](py::object filename, std::size_t row_number,
+                       DPsim::RealTimeDataLogger::Mode mode,
+                       DPsim::Real drain_interval) {
+             py::object fspath =
+                 py::module_::import("os").attr("fspath")(filename);
+             std::string s = py::cast<std::string>(fspath);
+             std::filesystem::path p(s);
+             return std::make_shared<DPsim::RealTimeDataLogger>(
+                 p, row_number, mode, drain_interval);
+           }),
+           "filename"_a, "row_number"_a, "mode"_a, "drain_interval"_a = 0.01)
+
+      .def("dropped_rows", &DPsim::RealTimeDataLogger::droppedRows)
+
+      .def("column_names", &DPsim::RealTimeDataLogger::columnNames)
+
+      /// Read-only NumPy view of the preallocated rows, which keeps the
+      /// logger alive instead of copying the data
+      .def("data",
+           [](py::object self) {
+             auto &logger = self.cast<DPsim::RealTimeDataLogger &>();
+             if (logger.mode() != DPsim::RealTimeDataLogger::Mode::Preallocate)
+               throw std::runtime_error(
+                   "RealTimeDataLogger: Data is only kept in preallocate mode");
+             if (logger.data().empty())
+               throw std::runtime_error(
+                   "RealTimeDataLogger: Logger has not been started");
+
+             py::ssize_t itemSize = sizeof(DPsim::Real);
+             py::ssize_t rowSize = logger.rowSize();
+             py::array_t<DPsim::Real> array(
+                 {static_cast<py::ssize_t>(logger.rowNumber()), rowSize},
+                 {rowSize * itemSize, itemSize}, logger.data().data(), self);
+             array.attr("flags").attr("writeable") = false;
+             return array;
+           })
+
       .def("log_attribute",
            py::overload_cast<const CPS::String &, CPS::AttributeBase::Ptr,
                              CPS::UInt, CPS::UInt>(
@@ -377,6 +448,101 @@ PYBIND11_MODULE(dpsimpy, m) {
           },
           "names"_a, "attr"_a, "comp"_a);
 
+  py::class_<DPsim::TriggeredDataLogger, DPsim::DataLoggerInterface,
+             std::shared_ptr<DPsim::TriggeredDataLogger>>
+      triggeredDataLogger(m, "TriggeredDataLogger");
+
+  py::enum_<DPsim::TriggeredDataLogger::Edge>(triggeredDataLogger, "Edge")
+      .value("Rising", DPsim::TriggeredDataLogger::Edge::Rising)
+      .value("Falling", DPsim::TriggeredDataLogger::Edge::Falling)
+      .value("Both", DPsim::TriggeredDataLogger::Edge::Both);
+
+  triggeredDataLogger
+      .def(py::init<std::string, CPS::UInt, CPS::UInt, CPS::UInt>(), "name"_a,
+           "pre_trigger_steps"_a, "post_trigger_steps"_a,
+           "coarse_downsampling"_a = 0)
+      .def("trigger", &DPsim::TriggeredDataLogger::trigger)
+      .def("add_threshold_trigger",
+           &DPsim::TriggeredDataLogger::addThresholdTrigger, "attr"_a,
+           "threshold"_a, "edge"_a = DPsim::TriggeredDataLogger::Edge::Both)
+      .def("add_change_trigger", &DPsim::TriggeredDataLogger::addChangeTrigger,
+           "attr"_a)
+      .def("add_switch_trigger",
+           py::overload_cast<const std::shared_ptr<CPS::Base::Ph1::Switch> &>(
+               &DPsim::TriggeredDataLogger::addSwitchTrigger),
+           "switch"_a)
+      .def("add_switch_trigger",
+           py::overload_cast<const std::shared_ptr<CPS::Base::Ph3::Switch> &>(
+               &DPsim::TriggeredDataLogger::addSwitchTrigger),
+           "switch"_a)
+      .def("trigger_on", &DPsim::TriggeredDataLogger::triggerOn, "event"_a)
+      .def("trigger_count", &DPsim::TriggeredDataLogger::triggerCount)
+      .def(
+          "log_attribute",
+          [](DPsim::TriggeredDataLogger &logger, const CPS::String &name,
+             const CPS::String &attr, const CPS::IdentifiedObject &comp,
+             CPS::UInt rowsMax, CPS::UInt colsMax) {
+            logger.logAttribute(name, comp.attribute(attr), rowsMax, colsMax);
+          },
+          "name"_a, "attr"_a, "comp"_a, "rows_max"_a = 0, "cols_max"_a = 0);
+
+  py::class_<DPsim::AggregatingDataLogger, DPsim::DataLoggerInterface,
+             std::shared_ptr<DPsim::AggregatingDataLogger>>
+      aggregatingDataLogger(m, "AggregatingDataLogger");
+
+  py::enum_<DPsim::AggregatingDataLogger::Statistic>(aggregatingDataLogger,
+                                                     "Statistic",
+                                                     py::arithmetic())
+      .value("Min", DPsim::AggregatingDataLogger::Min)
+      .value("Max", DPsim::AggregatingDataLogger::Max)
+      .value("Mean", DPsim::AggregatingDataLogger::Mean)
+      .value("RMS", DPsim::AggregatingDataLogger::RMS)
+      .value("Last", DPsim::AggregatingDataLogger::Last);
+
+  aggregatingDataLogger
+      .def(py::init<std::string, CPS::UInt, CPS::UInt>(), "name"_a,
+           "window_steps"_a,
+           "statistics"_a = DPsim::AggregatingDataLogger::DefaultStatistics)
+      .def(
+          "log_attribute",
+          [](DPsim::AggregatingDataLogger &logger, const CPS::String &name,
+             const CPS::String &attr, const CPS::IdentifiedObject &comp,
+             CPS::UInt rowsMax, CPS::UInt colsMax) {
+            logger.logAttribute(name, comp.attribute(attr), rowsMax, colsMax);
+          },
+          "name"_a, "attr"_a, "comp"_a, "rows_max"_a = 0, "cols_max"_a = 0);
+
+  py::class_<DPsim::InMemoryDataLogger, DPsim::DataLoggerInterface,
+             std::shared_ptr<DPsim::InMemoryDataLogger>>(m,
+                                                         "InMemoryDataLogger")
+      .def(py::init<CPS::UInt>(), "downsampling"_a = 1)
+      .def(py::init<DPsim::Real, DPsim::Real, CPS::UInt>(), "final_time"_a,
+           "time_step"_a, "downsampling"_a = 1)
+      .def(
+          "log_attribute",
+          [](DPsim::InMemoryDataLogger &logger, const CPS::String &name,
+             const CPS::String &attr, const CPS::IdentifiedObject &comp,
+             CPS::UInt rowsMax, CPS::UInt colsMax) {
+            logger.logAttribute(name, comp.attribute(attr), rowsMax, colsMax);
+          },
+          "name"_a, "attr"_a, "comp"_a, "rows_max"_a = 0, "cols_max"_a = 0)
+      .def("column_names", &DPsim::InMemoryDataLogger::columnNames)
+      .def("row_count", &DPsim::InMemoryDataLogger::rowCount)
+      /// The views keep the values of their run when the logger is started
+      /// again
+      .def(
+          "get_column",
+          [](const DPsim::InMemoryDataLogger &logger, const CPS::String &name) {
+            return columnView(logger.getSharedColumn(name));
+          },
+          "name"_a)
+      .def("columns", [](const DPsim::InMemoryDataLogger &logger) {
+        py::dict columns;
+        for (auto &name : logger.columnNames())
+          columns[py::str(name)] = columnView(logger.getSharedColumn(name));
+        return columns;
+      });
+
   py::class_<CPS::IdentifiedObject, std::shared_ptr<CPS::IdentifiedObject>>(
       m, "IdentifiedObject")
       .def("name", &CPS::IdentifiedObject::name)